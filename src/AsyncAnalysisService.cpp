@@ -0,0 +1,82 @@
+#include "AsyncAnalysisService.h"
+#include <QtConcurrent/QtConcurrent>
+
+AsyncAnalysisService::AsyncAnalysisService(QObject* parent)
+    : QObject(parent), latestRequestId(0), pendingRequest{0, 0.0, 0.0}, hasPendingRequest(false) {
+    qRegisterMetaType<HealthEffects>("HealthEffects");
+    connect(&watcher, &QFutureWatcher<AnalysisResult>::finished,
+            this, &AsyncAnalysisService::onWorkerFinished);
+}
+
+AsyncAnalysisService::~AsyncAnalysisService() {
+    // El trabajador lee latestRequestId: hay que esperarlo antes de destruirlo
+    cancelAll();
+    watcher.waitForFinished();
+}
+
+quint64 AsyncAnalysisService::requestAnalysis(double microSieverts, double exposureHours) {
+    AnalysisRequest request = { latestRequestId.load() + 1, microSieverts, exposureHours };
+    latestRequestId.store(request.id);
+
+    if (watcher.isRunning()) {
+        // El trabajo en curso verá el nuevo id y abortará en su siguiente punto de control
+        pendingRequest = request;
+        hasPendingRequest = true;
+    } else {
+        startWorker(request);
+    }
+
+    return request.id;
+}
+
+void AsyncAnalysisService::cancelAll() {
+    hasPendingRequest = false;
+    latestRequestId.store(latestRequestId.load() + 1);
+}
+
+bool AsyncAnalysisService::isBusy() const {
+    return watcher.isRunning() || hasPendingRequest;
+}
+
+void AsyncAnalysisService::onWorkerFinished() {
+    AnalysisResult result = watcher.result();
+
+    if (result.completed && result.id == latestRequestId.load()) {
+        emit analysisReady(result.id, result.effects, result.report);
+    }
+
+    if (hasPendingRequest) {
+        hasPendingRequest = false;
+        startWorker(pendingRequest);
+    }
+}
+
+void AsyncAnalysisService::startWorker(const AnalysisRequest& request) {
+    const std::atomic<quint64>* latest = &latestRequestId;
+    watcher.setFuture(QtConcurrent::run([request, latest]() {
+        return runAnalysis(request, latest);
+    }));
+}
+
+AsyncAnalysisService::AnalysisResult AsyncAnalysisService::runAnalysis(const AnalysisRequest& request,
+                                                                       const std::atomic<quint64>* latest) {
+    AnalysisResult result;
+    result.id = request.id;
+    result.completed = false;
+
+    if (request.id != latest->load()) {
+        return result;
+    }
+
+    HealthEffectAnalyzer analyzer;
+    result.effects = analyzer.analyzeEffects(request.microSieverts, request.exposureHours);
+
+    // Punto de control: si llegó una petición más reciente no formateamos
+    if (request.id != latest->load()) {
+        return result;
+    }
+
+    result.report = QString::fromStdString(analyzer.formatHealthEffectsReport(result.effects));
+    result.completed = request.id == latest->load();
+    return result;
+}
@@ -0,0 +1,56 @@
+#ifndef ASYNCANALYSISSERVICE_H
+#define ASYNCANALYSISSERVICE_H
+
+#include <QObject>
+#include <QFutureWatcher>
+#include <QMetaType>
+#include <QString>
+#include <atomic>
+#include "HealthEffectAnalyzer.h"
+
+Q_DECLARE_METATYPE(HealthEffects)
+
+// Análisis de efectos y generación del informe fuera del hilo de la GUI.
+// Solo hay un trabajo en curso; las peticiones nuevas sustituyen a la
+// pendiente (gana la última) y los resultados obsoletos se descartan.
+class AsyncAnalysisService : public QObject {
+    Q_OBJECT
+
+public:
+    explicit AsyncAnalysisService(QObject* parent = nullptr);
+    ~AsyncAnalysisService() override;
+
+    quint64 requestAnalysis(double microSieverts, double exposureHours = 1.0);
+    void cancelAll();
+    bool isBusy() const;
+
+signals:
+    void analysisReady(quint64 requestId, const HealthEffects& effects, const QString& report);
+
+private slots:
+    void onWorkerFinished();
+
+private:
+    struct AnalysisRequest {
+        quint64 id;
+        double microSieverts;
+        double exposureHours;
+    };
+
+    struct AnalysisResult {
+        quint64 id;
+        bool completed;
+        HealthEffects effects;
+        QString report;
+    };
+
+    QFutureWatcher<AnalysisResult> watcher;
+    std::atomic<quint64> latestRequestId;
+    AnalysisRequest pendingRequest;
+    bool hasPendingRequest;
+
+    void startWorker(const AnalysisRequest& request);
+    static AnalysisResult runAnalysis(const AnalysisRequest& request, const std::atomic<quint64>* latest);
+};
+
+#endif // ASYNCANALYSISSERVICE_H
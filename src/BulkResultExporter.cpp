@@ -0,0 +1,401 @@
+#include "BulkResultExporter.h"
+#include <algorithm>
+#include <cmath>
+#include <charconv>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <thread>
+
+// Formato columnar (little-endian):
+//   Cabecera: "RADC" | u16 versión | u16 flags | u16 nº columnas | (u8 tipo, u8 long., nombre)*
+//   Bloque:   "CHNK" | u32 filas | por columna: u8 codificación, f64 mín, f64 máx, u32 bytes, datos
+//   Pie:      "RADE" | u64 filas totales | u32 nº bloques
+
+namespace {
+    const uint16_t FORMAT_VERSION = 1;
+    const uint16_t FLAG_COMPRESSED = 0x1;
+
+    enum ColumnType : uint8_t {
+        COLUMN_INT64 = 1,
+        COLUMN_UINT32 = 2,
+        COLUMN_FLOAT64 = 3,
+        COLUMN_UINT8 = 4
+    };
+
+    enum ColumnEncoding : uint8_t {
+        ENCODING_PLAIN = 0,
+        ENCODING_DELTA_VARINT = 1,
+        ENCODING_RUN_LENGTH = 2
+    };
+
+    struct ColumnInfo {
+        const char* name;
+        ColumnType type;
+    };
+
+    const ColumnInfo COLUMNS[] = {
+        { "timestamp_ms", COLUMN_INT64 },
+        { "sensor_id", COLUMN_UINT32 },
+        { "micro_sieverts_h", COLUMN_FLOAT64 },
+        { "danger_level", COLUMN_UINT8 },
+        { "gauge_percent", COLUMN_UINT8 },
+        { "total_dose_usv", COLUMN_FLOAT64 },
+        { "survival_untreated", COLUMN_FLOAT64 },
+        { "survival_treated", COLUMN_FLOAT64 }
+    };
+    const size_t COLUMN_COUNT = sizeof(COLUMNS) / sizeof(COLUMNS[0]);
+
+    const char* LEVEL_NAMES[] = { "SAFE", "CAUTION", "DANGEROUS", "EXTREME", "LETHAL" };
+
+    // Escritura binaria little-endian independiente de la plataforma
+    void putBytes(std::string& buffer, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void putDouble(std::string& buffer, double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        putBytes(buffer, bits, 8);
+    }
+
+    void putVarint(std::string& buffer, uint64_t value) {
+        while (value >= 0x80) {
+            buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<char>(value));
+    }
+
+    uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    template <typename T, typename Getter>
+    void putColumn(std::string& chunk, const AnalysisRecord* records, size_t count,
+                   ColumnType type, bool compress, Getter get) {
+        double minValue = std::numeric_limits<double>::infinity();
+        double maxValue = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < count; ++i) {
+            double v = static_cast<double>(get(records[i]));
+            minValue = std::min(minValue, v);
+            maxValue = std::max(maxValue, v);
+        }
+
+        std::string data;
+        ColumnEncoding encoding = ENCODING_PLAIN;
+
+        if (compress && (type == COLUMN_INT64 || type == COLUMN_UINT32)) {
+            encoding = ENCODING_DELTA_VARINT;
+            int64_t previous = 0;
+            for (size_t i = 0; i < count; ++i) {
+                int64_t v = static_cast<int64_t>(get(records[i]));
+                putVarint(data, zigzag(v - previous));
+                previous = v;
+            }
+        } else if (compress && type == COLUMN_UINT8) {
+            encoding = ENCODING_RUN_LENGTH;
+            size_t i = 0;
+            while (i < count) {
+                uint8_t v = static_cast<uint8_t>(get(records[i]));
+                size_t run = 1;
+                while (i + run < count && static_cast<uint8_t>(get(records[i + run])) == v) {
+                    ++run;
+                }
+                data.push_back(static_cast<char>(v));
+                putVarint(data, run);
+                i += run;
+            }
+        } else {
+            data.reserve(count * sizeof(T));
+            for (size_t i = 0; i < count; ++i) {
+                if (type == COLUMN_FLOAT64) {
+                    putDouble(data, static_cast<double>(get(records[i])));
+                } else {
+                    putBytes(data, static_cast<uint64_t>(get(records[i])), sizeof(T));
+                }
+            }
+        }
+
+        chunk.push_back(static_cast<char>(encoding));
+        putDouble(chunk, minValue);
+        putDouble(chunk, maxValue);
+        putBytes(chunk, data.size(), 4);
+        chunk += data;
+    }
+
+    // Números con std::to_chars: sin locale ni asignaciones
+    void appendNumber(std::string& buffer, double value) {
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer.append(digits, result.ptr);
+    }
+
+    // JSON no admite NaN ni infinitos: se escriben como null
+    void appendJsonNumber(std::string& buffer, double value) {
+        if (std::isfinite(value)) {
+            appendNumber(buffer, value);
+        } else {
+            buffer += "null";
+        }
+    }
+
+    void appendNumber(std::string& buffer, int64_t value) {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer.append(digits, result.ptr);
+    }
+
+    // La columna del indicador es de 8 bits: se satura a [0, 100] antes del cast
+    uint8_t clampGauge(int percent) {
+        return static_cast<uint8_t>(percent < 0 ? 0 : (percent > 100 ? 100 : percent));
+    }
+
+    const char* levelName(DangerLevel level) {
+        int index = static_cast<int>(level);
+        return (index >= 0 && index < 5) ? LEVEL_NAMES[index] : LEVEL_NAMES[0];
+    }
+}
+
+BulkResultExporter::BulkResultExporter()
+    : rowsWritten(0), chunksWritten(0), workers(1), isOpen(false), failed(false) {
+}
+
+BulkResultExporter::~BulkResultExporter() {
+    close();
+}
+
+bool BulkResultExporter::open(const std::string& path, const ExportOptions& exportOptions) {
+    close();
+
+    options = exportOptions;
+    options.chunkRows = std::max<size_t>(1, options.chunkRows);
+    workers = options.workerThreads ? options.workerThreads : std::max(1u, std::thread::hardware_concurrency());
+    rowsWritten = 0;
+    chunksWritten = 0;
+    failed = false;
+
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    pending.clear();
+    pending.reserve(options.chunkRows * workers);
+    isOpen = true;
+    writeHeader();
+    return !failed;
+}
+
+bool BulkResultExporter::append(const AnalysisRecord& record) {
+    return append(&record, 1);
+}
+
+bool BulkResultExporter::append(const AnalysisRecord* records, size_t count) {
+    if (!isOpen || failed) return false;
+
+    size_t capacity = options.chunkRows * workers;
+    while (count > 0) {
+        size_t room = capacity - pending.size();
+        size_t take = std::min(room, count);
+        pending.insert(pending.end(), records, records + take);
+        records += take;
+        count -= take;
+
+        if (pending.size() == capacity && !flushPending()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BulkResultExporter::close() {
+    if (!isOpen) return !failed;
+
+    flushPending();
+    writeFooter();
+    out.close();
+    isOpen = false;
+    return !failed;
+}
+
+uint64_t BulkResultExporter::getRowsWritten() {
+    return rowsWritten;
+}
+
+AnalysisRecord BulkResultExporter::makeRecord(int64_t timestampMs, uint32_t sensorId, double microSieverts,
+                                              double exposureHours, RadiationCalculator& calculator,
+                                              HealthEffectAnalyzer& analyzer) {
+    AnalysisRecord record;
+    record.timestampMs = timestampMs;
+    record.sensorId = sensorId;
+    record.microSieverts = microSieverts;
+    record.dangerLevel = calculator.getDangerLevel(microSieverts);
+    record.gaugePercent = calculator.getDangerPercentage(microSieverts);
+    record.totalDose = microSieverts * exposureHours;
+    record.survivalWithoutTreatment = analyzer.getSurvivalProbability(record.totalDose, false);
+    record.survivalWithTreatment = analyzer.getSurvivalProbability(record.totalDose, true);
+    return record;
+}
+
+bool BulkResultExporter::flushPending() {
+    if (pending.empty() || failed) return !failed;
+
+    // Un bloque por tarea; los resultados se escriben en el orden original
+    std::vector<std::future<std::string>> encoded;
+    for (size_t start = 0; start < pending.size(); start += options.chunkRows) {
+        size_t rows = std::min(options.chunkRows, pending.size() - start);
+        const AnalysisRecord* chunk = pending.data() + start;
+        encoded.push_back(std::async(std::launch::async, [this, chunk, rows]() {
+            return encodeChunk(chunk, rows);
+        }));
+    }
+
+    for (auto& future : encoded) {
+        std::string bytes = future.get();
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        ++chunksWritten;
+    }
+
+    rowsWritten += pending.size();
+    pending.clear();
+
+    if (!out) {
+        failed = true;
+    }
+    return !failed;
+}
+
+void BulkResultExporter::writeHeader() {
+    std::string header;
+
+    switch (options.format) {
+        case ExportFormat::COLUMNAR:
+            header += "RADC";
+            putBytes(header, FORMAT_VERSION, 2);
+            putBytes(header, options.compress ? FLAG_COMPRESSED : 0, 2);
+            putBytes(header, COLUMN_COUNT, 2);
+            for (const auto& column : COLUMNS) {
+                size_t length = std::strlen(column.name);
+                header.push_back(static_cast<char>(column.type));
+                header.push_back(static_cast<char>(length));
+                header.append(column.name, length);
+            }
+            break;
+        case ExportFormat::CSV:
+            for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+                header += COLUMNS[i].name;
+                header += i + 1 < COLUMN_COUNT ? ',' : '\n';
+            }
+            break;
+        case ExportFormat::NDJSON:
+            break;
+    }
+
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    if (!out) failed = true;
+}
+
+void BulkResultExporter::writeFooter() {
+    if (options.format != ExportFormat::COLUMNAR) return;
+
+    std::string footer = "RADE";
+    putBytes(footer, rowsWritten, 8);
+    putBytes(footer, chunksWritten, 4);
+    out.write(footer.data(), static_cast<std::streamsize>(footer.size()));
+    if (!out) failed = true;
+}
+
+std::string BulkResultExporter::encodeChunk(const AnalysisRecord* records, size_t count) {
+    switch (options.format) {
+        case ExportFormat::CSV:
+            return encodeCsvChunk(records, count);
+        case ExportFormat::NDJSON:
+            return encodeNdjsonChunk(records, count);
+        case ExportFormat::COLUMNAR:
+        default:
+            return encodeColumnarChunk(records, count);
+    }
+}
+
+std::string BulkResultExporter::encodeColumnarChunk(const AnalysisRecord* records, size_t count) {
+    std::string chunk = "CHNK";
+    putBytes(chunk, count, 4);
+    bool compress = options.compress;
+
+    putColumn<int64_t>(chunk, records, count, COLUMN_INT64, compress,
+                       [](const AnalysisRecord& r) { return r.timestampMs; });
+    putColumn<uint32_t>(chunk, records, count, COLUMN_UINT32, compress,
+                        [](const AnalysisRecord& r) { return r.sensorId; });
+    putColumn<double>(chunk, records, count, COLUMN_FLOAT64, compress,
+                      [](const AnalysisRecord& r) { return r.microSieverts; });
+    putColumn<uint8_t>(chunk, records, count, COLUMN_UINT8, compress,
+                       [](const AnalysisRecord& r) { return static_cast<uint8_t>(r.dangerLevel); });
+    putColumn<uint8_t>(chunk, records, count, COLUMN_UINT8, compress,
+                       [](const AnalysisRecord& r) { return clampGauge(r.gaugePercent); });
+    putColumn<double>(chunk, records, count, COLUMN_FLOAT64, compress,
+                      [](const AnalysisRecord& r) { return r.totalDose; });
+    putColumn<double>(chunk, records, count, COLUMN_FLOAT64, compress,
+                      [](const AnalysisRecord& r) { return r.survivalWithoutTreatment; });
+    putColumn<double>(chunk, records, count, COLUMN_FLOAT64, compress,
+                      [](const AnalysisRecord& r) { return r.survivalWithTreatment; });
+
+    return chunk;
+}
+
+std::string BulkResultExporter::encodeCsvChunk(const AnalysisRecord* records, size_t count) {
+    std::string text;
+    text.reserve(count * 96);
+
+    for (size_t i = 0; i < count; ++i) {
+        const AnalysisRecord& r = records[i];
+        appendNumber(text, r.timestampMs);
+        text += ',';
+        appendNumber(text, static_cast<int64_t>(r.sensorId));
+        text += ',';
+        appendNumber(text, r.microSieverts);
+        text += ',';
+        text += levelName(r.dangerLevel);
+        text += ',';
+        appendNumber(text, static_cast<int64_t>(r.gaugePercent));
+        text += ',';
+        appendNumber(text, r.totalDose);
+        text += ',';
+        appendNumber(text, r.survivalWithoutTreatment);
+        text += ',';
+        appendNumber(text, r.survivalWithTreatment);
+        text += '\n';
+    }
+
+    return text;
+}
+
+std::string BulkResultExporter::encodeNdjsonChunk(const AnalysisRecord* records, size_t count) {
+    std::string text;
+    text.reserve(count * 192);
+
+    for (size_t i = 0; i < count; ++i) {
+        const AnalysisRecord& r = records[i];
+        text += "{\"timestamp_ms\":";
+        appendNumber(text, r.timestampMs);
+        text += ",\"sensor_id\":";
+        appendNumber(text, static_cast<int64_t>(r.sensorId));
+        text += ",\"micro_sieverts_h\":";
+        appendJsonNumber(text, r.microSieverts);
+        text += ",\"danger_level\":\"";
+        text += levelName(r.dangerLevel);
+        text += "\",\"gauge_percent\":";
+        appendNumber(text, static_cast<int64_t>(r.gaugePercent));
+        text += ",\"total_dose_usv\":";
+        appendJsonNumber(text, r.totalDose);
+        text += ",\"survival_untreated\":";
+        appendJsonNumber(text, r.survivalWithoutTreatment);
+        text += ",\"survival_treated\":";
+        appendJsonNumber(text, r.survivalWithTreatment);
+        text += "}\n";
+    }
+
+    return text;
+}
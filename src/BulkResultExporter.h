@@ -0,0 +1,77 @@
+#ifndef BULKRESULTEXPORTER_H
+#define BULKRESULTEXPORTER_H
+
+#include "RadiationCalculator.h"
+#include "HealthEffectAnalyzer.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct AnalysisRecord {
+    int64_t timestampMs;
+    uint32_t sensorId;
+    double microSieverts;
+    DangerLevel dangerLevel;
+    int gaugePercent;
+    double totalDose;
+    double survivalWithoutTreatment;
+    double survivalWithTreatment;
+};
+
+enum class ExportFormat {
+    COLUMNAR,   // Binario por columnas, autodescriptivo (.radc)
+    CSV,
+    NDJSON
+};
+
+struct ExportOptions {
+    ExportFormat format = ExportFormat::COLUMNAR;
+    bool compress = false;          // Delta/varint en enteros y RLE en columnas de 8 bits
+    size_t chunkRows = 65536;       // Filas por bloque codificado
+    unsigned workerThreads = 0;     // 0 = std::thread::hardware_concurrency()
+};
+
+// Exportación masiva de resultados de análisis. Los registros se acumulan
+// en bloques; cuando hay uno por hilo se codifican en paralelo y se
+// escriben en orden, de modo que la memoria queda acotada a
+// chunkRows * workerThreads registros.
+class BulkResultExporter {
+public:
+    BulkResultExporter();
+    ~BulkResultExporter();
+
+    bool open(const std::string& path, const ExportOptions& exportOptions = ExportOptions());
+    bool append(const AnalysisRecord& record);
+    bool append(const AnalysisRecord* records, size_t count);
+    bool close();
+
+    uint64_t getRowsWritten();
+
+    // Construye un registro a partir de una lectura y su análisis
+    static AnalysisRecord makeRecord(int64_t timestampMs, uint32_t sensorId, double microSieverts,
+                                     double exposureHours, RadiationCalculator& calculator,
+                                     HealthEffectAnalyzer& analyzer);
+
+private:
+    std::ofstream out;
+    ExportOptions options;
+    std::vector<AnalysisRecord> pending;
+    uint64_t rowsWritten;
+    uint32_t chunksWritten;
+    unsigned workers;
+    bool isOpen;
+    bool failed;
+
+    bool flushPending();
+    void writeHeader();
+    void writeFooter();
+
+    std::string encodeChunk(const AnalysisRecord* records, size_t count);
+    std::string encodeColumnarChunk(const AnalysisRecord* records, size_t count);
+    std::string encodeCsvChunk(const AnalysisRecord* records, size_t count);
+    std::string encodeNdjsonChunk(const AnalysisRecord* records, size_t count);
+};
+
+#endif // BULKRESULTEXPORTER_H
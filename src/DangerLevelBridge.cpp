@@ -0,0 +1,95 @@
+#include "DangerLevelBridge.h"
+#include "HealthEffectAnalyzer.h"
+
+namespace {
+    const int MEDICAL_BAND_COUNT = 5;
+
+    struct BridgeTables {
+        QString descriptions[DangerLevelBridge::LEVEL_COUNT];
+        QString colorNames[DangerLevelBridge::LEVEL_COUNT];
+        QColor colors[DangerLevelBridge::LEVEL_COUNT];
+        QString protocols[DangerLevelBridge::LEVEL_COUNT];
+        QString levelNames[DangerLevelBridge::LEVEL_COUNT];
+        QString medicalClassifications[MEDICAL_BAND_COUNT];
+
+        BridgeTables() {
+            // Se construyen desde el núcleo para no duplicar los textos
+            RadiationCalculator calc;
+            HealthEffectAnalyzer analyzer;
+            const DangerLevel levels[] = {
+                DangerLevel::SAFE, DangerLevel::CAUTION, DangerLevel::DANGEROUS,
+                DangerLevel::EXTREME, DangerLevel::LETHAL
+            };
+            const char* names[] = { "SAFE", "CAUTION", "DANGEROUS", "EXTREME", "LETHAL" };
+
+            for (int i = 0; i < DangerLevelBridge::LEVEL_COUNT; ++i) {
+                descriptions[i] = QString::fromStdString(calc.getDangerDescription(levels[i]));
+                colorNames[i] = QString::fromStdString(calc.getDangerColor(levels[i]));
+                colors[i] = QColor(colorNames[i]);
+                protocols[i] = QString::fromStdString(analyzer.getEmergencyProtocol(levels[i]));
+                levelNames[i] = QString::fromLatin1(names[i]);
+            }
+
+            // Un valor representativo por banda de getMedicalClassification
+            const double bandSamples[] = { 0.0, 2.0, 100.0, 1000.0, 10000.0 };
+            for (int i = 0; i < MEDICAL_BAND_COUNT; ++i) {
+                medicalClassifications[i] = QString::fromStdString(analyzer.getMedicalClassification(bandSamples[i]));
+            }
+        }
+    };
+
+    const BridgeTables& tables() {
+        static const BridgeTables instance;
+        return instance;
+    }
+}
+
+const QString& DangerLevelBridge::getDangerDescription(DangerLevel level) {
+    return tables().descriptions[indexOf(level)];
+}
+
+const QString& DangerLevelBridge::getDangerColorName(DangerLevel level) {
+    return tables().colorNames[indexOf(level)];
+}
+
+const QColor& DangerLevelBridge::getDangerColor(DangerLevel level) {
+    return tables().colors[indexOf(level)];
+}
+
+const QString& DangerLevelBridge::getEmergencyProtocol(DangerLevel level) {
+    return tables().protocols[indexOf(level)];
+}
+
+const QString& DangerLevelBridge::getMedicalClassification(double microSieverts) {
+    int band = 0;
+    if (microSieverts >= 10000.0) band = 4;
+    else if (microSieverts >= 1000.0) band = 3;
+    else if (microSieverts >= 100.0) band = 2;
+    else if (microSieverts >= 2.0) band = 1;
+    return tables().medicalClassifications[band];
+}
+
+QString DangerLevelBridge::getAutoFormattedValue(double microSieverts) {
+    // Cortes, precisiones y sufijos salen del registro de unidades
+    RadiationCalculator calc;
+    return QString::fromStdString(calc.getAutoFormattedValue(microSieverts));
+}
+
+const QString& DangerLevelBridge::getLevelName(DangerLevel level) {
+    return tables().levelNames[indexOf(level)];
+}
+
+DangerLevel DangerLevelBridge::fromLevelName(const QString& name) {
+    const BridgeTables& t = tables();
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        if (t.levelNames[i] == name) {
+            return static_cast<DangerLevel>(i);
+        }
+    }
+    return DangerLevel::SAFE;
+}
+
+int DangerLevelBridge::indexOf(DangerLevel level) {
+    int index = static_cast<int>(level);
+    return (index >= 0 && index < LEVEL_COUNT) ? index : 0;
+}
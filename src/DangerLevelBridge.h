@@ -0,0 +1,36 @@
+#ifndef DANGERLEVELBRIDGE_H
+#define DANGERLEVELBRIDGE_H
+
+#include <QColor>
+#include <QString>
+#include "RadiationCalculator.h"
+
+// Puente entre el núcleo (std::string) y los widgets (QString/QColor).
+// Los textos y colores fijos se convierten una sola vez, en tablas
+// compartidas indexadas por DangerLevel, para que refrescar la interfaz
+// no decodifique UTF-8 ni compare cadenas.
+class DangerLevelBridge {
+public:
+    static const int LEVEL_COUNT = 5;
+
+    // Textos y colores por nivel
+    static const QString& getDangerDescription(DangerLevel level);
+    static const QString& getDangerColorName(DangerLevel level);
+    static const QColor& getDangerColor(DangerLevel level);
+    static const QString& getEmergencyProtocol(DangerLevel level);
+
+    // Clasificación médica (por bandas de μSv/h, no por nivel)
+    static const QString& getMedicalClassification(double microSieverts);
+
+    // Valor con unidad, equivalente a RadiationCalculator::getAutoFormattedValue
+    static QString getAutoFormattedValue(double microSieverts);
+
+    // Nombres simbólicos ("SAFE", "CAUTION", ...) para compatibilidad
+    static const QString& getLevelName(DangerLevel level);
+    static DangerLevel fromLevelName(const QString& name);
+
+private:
+    static int indexOf(DangerLevel level);
+};
+
+#endif // DANGERLEVELBRIDGE_H
@@ -0,0 +1,178 @@
+#include "DecayProjectionEngine.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const double LN2 = 0.69314718055994530942;
+    const int MAX_SOLVER_ITERATIONS = 64;
+    const double SOLVER_TOLERANCE_HOURS = 1e-6;
+    // Horizonte máximo de búsqueda para getTimeToDoseLimit (~1000 años)
+    const double MAX_PROJECTION_HOURS = 8760.0 * 1000.0;
+}
+
+DecayProjectionEngine::DecayProjectionEngine() {
+}
+
+void DecayProjectionEngine::setInventory(const std::vector<IsotopeSource>& sources) {
+    inventory.clear();
+    decayConstants.clear();
+    initialRates.clear();
+    for (const auto& source : sources) {
+        addIsotope(source);
+    }
+}
+
+void DecayProjectionEngine::addIsotope(const IsotopeSource& source) {
+    inventory.push_back(source);
+    decayConstants.push_back(source.halfLifeHours > 0.0 ? LN2 / source.halfLifeHours : 0.0);
+    initialRates.push_back(std::max(0.0, source.initialMicroSieverts));
+}
+
+const std::vector<IsotopeSource>& DecayProjectionEngine::getInventory() {
+    return inventory;
+}
+
+double DecayProjectionEngine::getDoseRateAt(double hours) {
+    return doseRate(initialRates.data(), decayConstants.data(), inventory.size(), hours);
+}
+
+double DecayProjectionEngine::getCumulativeDose(double hours) {
+    return cumulativeDose(initialRates.data(), decayConstants.data(), inventory.size(), hours);
+}
+
+std::vector<double> DecayProjectionEngine::projectDoseRateCurve(const std::vector<double>& timeGridHours) {
+    size_t points = timeGridHours.size();
+    std::vector<double> curve(points, 0.0);
+    const double* grid = timeGridHours.data();
+    double* out = curve.data();
+
+    // Isótopo por fuera y rejilla por dentro: el bucle interno es contiguo y vectorizable
+    for (size_t i = 0; i < inventory.size(); ++i) {
+        double rate = initialRates[i];
+        double lambda = decayConstants[i];
+        for (size_t j = 0; j < points; ++j) {
+            out[j] += rate * std::exp(-lambda * grid[j]);
+        }
+    }
+
+    return curve;
+}
+
+std::vector<double> DecayProjectionEngine::projectCumulativeDose(const std::vector<double>& timeGridHours) {
+    size_t points = timeGridHours.size();
+    std::vector<double> dose(points, 0.0);
+    const double* grid = timeGridHours.data();
+    double* out = dose.data();
+
+    for (size_t i = 0; i < inventory.size(); ++i) {
+        double rate = initialRates[i];
+        double lambda = decayConstants[i];
+        if (lambda > 0.0) {
+            double scale = rate / lambda;
+            for (size_t j = 0; j < points; ++j) {
+                out[j] += scale * -std::expm1(-lambda * grid[j]);
+            }
+        } else {
+            for (size_t j = 0; j < points; ++j) {
+                out[j] += rate * grid[j];
+            }
+        }
+    }
+
+    return dose;
+}
+
+double DecayProjectionEngine::getTimeToDoseLimit(double limitMicroSieverts) {
+    return solveTimeToLimit(initialRates.data(), decayConstants.data(), inventory.size(),
+                            limitMicroSieverts, MAX_PROJECTION_HOURS);
+}
+
+double DecayProjectionEngine::getSafeExposureTime() {
+    // Mismo criterio que RadiationCalculator::getSafeExposureTime, pero con decaimiento
+    return solveTimeToLimit(initialRates.data(), decayConstants.data(), inventory.size(),
+                            RadiationCalculator::ANNUAL_LIMIT, RadiationCalculator::HOURS_PER_YEAR);
+}
+
+void DecayProjectionEngine::getSafeExposureTimeBatch(const double* rates, size_t locations, double* outHours) {
+    size_t isotopes = inventory.size();
+    std::vector<double> row(isotopes);
+
+    for (size_t loc = 0; loc < locations; ++loc) {
+        const double* source = rates + loc * isotopes;
+        for (size_t i = 0; i < isotopes; ++i) {
+            row[i] = source[i] > 0.0 ? source[i] : 0.0;
+        }
+        outHours[loc] = solveTimeToLimit(row.data(), decayConstants.data(), isotopes,
+                                         RadiationCalculator::ANNUAL_LIMIT, RadiationCalculator::HOURS_PER_YEAR);
+    }
+}
+
+std::vector<double> DecayProjectionEngine::getSafeExposureTimeBatch(const std::vector<double>& rates) {
+    size_t isotopes = inventory.size();
+    size_t locations = isotopes > 0 ? rates.size() / isotopes : 0;
+    std::vector<double> hours(locations, RadiationCalculator::HOURS_PER_YEAR);
+    getSafeExposureTimeBatch(rates.data(), locations, hours.data());
+    return hours;
+}
+
+double DecayProjectionEngine::solveTimeToLimit(const double* rates, const double* lambdas,
+                                               size_t isotopes, double limit, double maxHours) {
+    // El resultado nunca supera maxHours: la dosis acumulada es creciente,
+    // así que si no se alcanza el límite en ese horizonte devolvemos el horizonte
+    if (limit <= 0.0) {
+        return 0.0;
+    }
+    if (cumulativeDose(rates, lambdas, isotopes, maxHours) < limit) {
+        return maxHours;
+    }
+
+    // Newton acotado: D(t) es creciente y cóncava, y si un paso de Newton
+    // sale del intervalo [lo, hi] se sustituye por bisección
+    double lo = 0.0;
+    double hi = maxHours;
+    double t = std::min(maxHours, limit / doseRate(rates, lambdas, isotopes, 0.0));
+
+    for (int iter = 0; iter < MAX_SOLVER_ITERATIONS; ++iter) {
+        double f = cumulativeDose(rates, lambdas, isotopes, t) - limit;
+        if (f < 0.0) {
+            lo = t;
+        } else {
+            hi = t;
+        }
+
+        double slope = doseRate(rates, lambdas, isotopes, t);
+        double next = slope > 0.0 ? t - f / slope : 0.5 * (lo + hi);
+        if (!(next > lo && next < hi)) {
+            next = 0.5 * (lo + hi);
+        }
+
+        if (std::fabs(next - t) < SOLVER_TOLERANCE_HOURS || hi - lo < SOLVER_TOLERANCE_HOURS) {
+            return next;
+        }
+        t = next;
+    }
+
+    return t;
+}
+
+double DecayProjectionEngine::cumulativeDose(const double* rates, const double* lambdas,
+                                             size_t isotopes, double hours) {
+    double dose = 0.0;
+    for (size_t i = 0; i < isotopes; ++i) {
+        if (lambdas[i] > 0.0) {
+            dose += rates[i] * -std::expm1(-lambdas[i] * hours) / lambdas[i];
+        } else {
+            dose += rates[i] * hours;
+        }
+    }
+    return dose;
+}
+
+double DecayProjectionEngine::doseRate(const double* rates, const double* lambdas,
+                                       size_t isotopes, double hours) {
+    double rate = 0.0;
+    for (size_t i = 0; i < isotopes; ++i) {
+        rate += rates[i] * std::exp(-lambdas[i] * hours);
+    }
+    return rate;
+}
@@ -0,0 +1,49 @@
+#ifndef DECAYPROJECTIONENGINE_H
+#define DECAYPROJECTIONENGINE_H
+
+#include "RadiationCalculator.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+struct IsotopeSource {
+    std::string isotope;
+    double halfLifeHours;         // <= 0 se trata como fuente estable
+    double initialMicroSieverts;  // Aporte a la tasa de dosis en t = 0 (μSv/h)
+};
+
+class DecayProjectionEngine {
+public:
+    DecayProjectionEngine();
+
+    // Inventario de isótopos
+    void setInventory(const std::vector<IsotopeSource>& sources);
+    void addIsotope(const IsotopeSource& source);
+    const std::vector<IsotopeSource>& getInventory();
+
+    // Proyección de la tasa de dosis (suma de exponenciales)
+    double getDoseRateAt(double hours);
+    double getCumulativeDose(double hours);
+    std::vector<double> projectDoseRateCurve(const std::vector<double>& timeGridHours);
+    std::vector<double> projectCumulativeDose(const std::vector<double>& timeGridHours);
+
+    // Tiempo hasta alcanzar un límite de dosis acumulada
+    double getTimeToDoseLimit(double limitMicroSieverts = RadiationCalculator::ANNUAL_LIMIT);
+    double getSafeExposureTime();
+
+    // Lotes: una fila de tasas iniciales por ubicación, una columna por isótopo del inventario
+    void getSafeExposureTimeBatch(const double* initialRates, size_t locations, double* outHours);
+    std::vector<double> getSafeExposureTimeBatch(const std::vector<double>& initialRates);
+
+private:
+    std::vector<IsotopeSource> inventory;
+    std::vector<double> decayConstants;  // λ = ln 2 / T½ (1/h)
+    std::vector<double> initialRates;
+
+    static double solveTimeToLimit(const double* rates, const double* lambdas,
+                                   size_t isotopes, double limit, double maxHours);
+    static double cumulativeDose(const double* rates, const double* lambdas, size_t isotopes, double hours);
+    static double doseRate(const double* rates, const double* lambdas, size_t isotopes, double hours);
+};
+
+#endif // DECAYPROJECTIONENGINE_H
@@ -0,0 +1,256 @@
+#include "DoseLedger.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    const int64_t SECONDS_PER_DAY = 86400;
+    const double NSV_PER_MICROSIEVERT = 1000.0;
+
+    int64_t floorDiv(int64_t a, int64_t b) {
+        int64_t q = a / b;
+        return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+    }
+
+    uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+}
+
+DoseLedger::DoseLedger()
+    : annualLimitQuanta(RadiationCalculator::ANNUAL_LIMIT * NSV_PER_MICROSIEVERT / DOSE_QUANTUM_NSV) {
+}
+
+int DoseLedger::registerWorker(const std::string& workerId) {
+    auto it = workerIndexById.find(workerId);
+    if (it != workerIndexById.end()) {
+        return it->second;
+    }
+
+    WorkerLedger ledger;
+    ledger.lastTimestamp = 0;
+    ledger.eventCount = 0;
+    ledger.currentMonth = 0;
+    std::fill(ledger.monthlyQuanta, ledger.monthlyQuanta + ROLLING_MONTHS, 0);
+    ledger.rollingQuanta = 0;
+    ledger.yearQuanta = 0;
+
+    int index = static_cast<int>(workers.size());
+    workers.push_back(ledger);
+    workerIndexById[workerId] = index;
+    return index;
+}
+
+int DoseLedger::findWorker(const std::string& workerId) {
+    auto it = workerIndexById.find(workerId);
+    return it != workerIndexById.end() ? it->second : -1;
+}
+
+size_t DoseLedger::getWorkerCount() {
+    return workers.size();
+}
+
+void DoseLedger::setAnnualLimit(double microSieverts) {
+    annualLimitQuanta = std::max(0.0, microSieverts) * NSV_PER_MICROSIEVERT / DOSE_QUANTUM_NSV;
+}
+
+double DoseLedger::getAnnualLimit() {
+    return annualLimitQuanta * DOSE_QUANTUM_NSV / NSV_PER_MICROSIEVERT;
+}
+
+bool DoseLedger::addExposure(int workerIndex, int64_t timestamp, double microSieverts) {
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return false;
+    if (!(microSieverts >= 0.0)) return false;
+
+    WorkerLedger& ledger = workers[workerIndex];
+    if (ledger.eventCount > 0 && timestamp < ledger.lastTimestamp) {
+        return false;  // Los eventos deben llegar en orden cronológico
+    }
+
+    int32_t month = monthIndexOf(timestamp);
+    if (ledger.eventCount == 0) {
+        ledger.currentMonth = month;
+    } else {
+        advanceMonth(ledger, month);
+    }
+
+    uint64_t quanta = static_cast<uint64_t>(std::llround(microSieverts * NSV_PER_MICROSIEVERT / DOSE_QUANTUM_NSV));
+    ledger.monthlyQuanta[month % ROLLING_MONTHS] += quanta;
+    ledger.rollingQuanta += quanta;
+    ledger.yearQuanta += quanta;
+
+    // El primer evento guarda la marca absoluta; los siguientes, el delta
+    int64_t delta = ledger.eventCount == 0 ? timestamp : timestamp - ledger.lastTimestamp;
+    putVarint(ledger.encodedEvents, zigzag(delta));
+    putVarint(ledger.encodedEvents, quanta);
+    ledger.lastTimestamp = timestamp;
+    ++ledger.eventCount;
+    return true;
+}
+
+std::vector<ExposureEvent> DoseLedger::getEvents(int workerIndex) {
+    std::vector<ExposureEvent> events;
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return events;
+
+    const WorkerLedger& ledger = workers[workerIndex];
+    events.reserve(ledger.eventCount);
+    const uint8_t* p = ledger.encodedEvents.data();
+    int64_t timestamp = 0;
+    for (uint32_t i = 0; i < ledger.eventCount; ++i) {
+        timestamp += unzigzag(readVarint(p));
+        double dose = readVarint(p) * static_cast<double>(DOSE_QUANTUM_NSV) / NSV_PER_MICROSIEVERT;
+        events.push_back({ timestamp, dose });
+    }
+    return events;
+}
+
+size_t DoseLedger::getStorageBytes(int workerIndex) {
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return 0;
+    return workers[workerIndex].encodedEvents.size();
+}
+
+double DoseLedger::getRollingTotal(int workerIndex, int64_t asOfTimestamp) {
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return 0.0;
+    uint64_t quanta = 0;
+    uint64_t yearQuanta = 0;
+    quantaAsOf(workers[workerIndex], asOfTimestamp, quanta, yearQuanta);
+    return quanta * static_cast<double>(DOSE_QUANTUM_NSV) / NSV_PER_MICROSIEVERT;
+}
+
+double DoseLedger::getCalendarYearTotal(int workerIndex, int64_t asOfTimestamp) {
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return 0.0;
+    uint64_t rollingQuanta = 0;
+    uint64_t quanta = 0;
+    quantaAsOf(workers[workerIndex], asOfTimestamp, rollingQuanta, quanta);
+    return quanta * static_cast<double>(DOSE_QUANTUM_NSV) / NSV_PER_MICROSIEVERT;
+}
+
+double DoseLedger::getRemainingSafeHours(int workerIndex, double microSievertsPerHour, int64_t asOfTimestamp) {
+    uint32_t index = static_cast<uint32_t>(workerIndex);
+    double hours = 0.0;
+    if (workerIndex < 0 || workerIndex >= static_cast<int>(workers.size())) return hours;
+    getRemainingSafeHoursBatch(&index, &microSievertsPerHour, 1, asOfTimestamp, &hours);
+    return hours;
+}
+
+void DoseLedger::getRemainingSafeHoursBatch(const uint32_t* workerIndices, const double* microSievertsPerHour,
+                                            size_t count, int64_t asOfTimestamp, double* outHours) {
+    // Mismo criterio que RadiationCalculator::getSafeExposureTime, descontando
+    // la mayor de las dosis de los últimos 12 meses y del año natural
+    double quantumMicroSieverts = DOSE_QUANTUM_NSV / NSV_PER_MICROSIEVERT;
+
+    for (size_t i = 0; i < count; ++i) {
+        // Un trabajador no registrado o una tasa NaN no tienen horas seguras
+        double rate = microSievertsPerHour[i];
+        if (workerIndices[i] >= workers.size() || std::isnan(rate)) {
+            outHours[i] = std::numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+
+        uint64_t rollingQuanta = 0;
+        uint64_t yearQuanta = 0;
+        quantaAsOf(workers[workerIndices[i]], asOfTimestamp, rollingQuanta, yearQuanta);
+        uint64_t used = std::max(rollingQuanta, yearQuanta);
+        double remaining = std::max(0.0, annualLimitQuanta - static_cast<double>(used)) * quantumMicroSieverts;
+
+        double hours = rate > 0.0 ? remaining / rate : RadiationCalculator::HOURS_PER_YEAR;
+        outHours[i] = std::min(hours, RadiationCalculator::HOURS_PER_YEAR);
+    }
+}
+
+int32_t DoseLedger::monthIndexOf(int64_t timestamp) {
+    // Conversión de días a fecha civil (algoritmo de H. Hinnant)
+    int64_t days = floorDiv(timestamp, SECONDS_PER_DAY) + 719468;
+    int64_t era = floorDiv(days, 146097);
+    int64_t dayOfEra = days - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+    int64_t month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    int64_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+    return static_cast<int32_t>(year * 12 + (month - 1));
+}
+
+void DoseLedger::advanceMonth(WorkerLedger& ledger, int32_t month) {
+    if (month <= ledger.currentMonth) return;
+
+    int32_t gap = month - ledger.currentMonth;
+    if (gap >= ROLLING_MONTHS) {
+        std::fill(ledger.monthlyQuanta, ledger.monthlyQuanta + ROLLING_MONTHS, 0);
+        ledger.rollingQuanta = 0;
+    } else {
+        // Cada mes nuevo reutiliza la casilla del mes que sale de la ventana
+        for (int32_t k = 1; k <= gap; ++k) {
+            uint64_t& slot = ledger.monthlyQuanta[(ledger.currentMonth + k) % ROLLING_MONTHS];
+            ledger.rollingQuanta -= slot;
+            slot = 0;
+        }
+    }
+
+    if (month / 12 != ledger.currentMonth / 12) {
+        ledger.yearQuanta = 0;
+    }
+    ledger.currentMonth = month;
+}
+
+void DoseLedger::quantaAsOf(const WorkerLedger& ledger, int64_t asOfTimestamp,
+                            uint64_t& rollingQuanta, uint64_t& yearQuanta) {
+    rollingQuanta = 0;
+    yearQuanta = 0;
+    if (ledger.eventCount == 0) return;
+
+    int32_t month = monthIndexOf(asOfTimestamp);
+
+    if (asOfTimestamp < ledger.lastTimestamp) {
+        // Consulta histórica: los acumulados incluyen dosis posteriores a la
+        // fecha pedida, así que se suman los eventos hasta ella
+        const uint8_t* p = ledger.encodedEvents.data();
+        int64_t timestamp = 0;
+        for (uint32_t i = 0; i < ledger.eventCount; ++i) {
+            timestamp += unzigzag(readVarint(p));
+            uint64_t quanta = readVarint(p);
+            if (timestamp > asOfTimestamp) break;
+
+            int32_t eventMonth = monthIndexOf(timestamp);
+            if (month - eventMonth < ROLLING_MONTHS) rollingQuanta += quanta;
+            if (eventMonth / 12 == month / 12) yearQuanta += quanta;
+        }
+        return;
+    }
+
+    yearQuanta = month / 12 == ledger.currentMonth / 12 ? ledger.yearQuanta : 0;
+
+    int32_t gap = month - ledger.currentMonth;
+    if (gap >= ROLLING_MONTHS) return;
+
+    // Como mucho 11 restas: la consulta sigue siendo de coste constante
+    rollingQuanta = ledger.rollingQuanta;
+    for (int32_t k = 1; k <= gap; ++k) {
+        rollingQuanta -= ledger.monthlyQuanta[(ledger.currentMonth + k) % ROLLING_MONTHS];
+    }
+}
+
+void DoseLedger::putVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint64_t DoseLedger::readVarint(const uint8_t*& p) {
+    uint64_t value = 0;
+    int shift = 0;
+    while (*p & 0x80) {
+        value |= static_cast<uint64_t>(*p & 0x7F) << shift;
+        shift += 7;
+        ++p;
+    }
+    value |= static_cast<uint64_t>(*p) << shift;
+    ++p;
+    return value;
+}
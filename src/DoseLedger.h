@@ -0,0 +1,80 @@
+#ifndef DOSELEDGER_H
+#define DOSELEDGER_H
+
+#include "RadiationCalculator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct ExposureEvent {
+    int64_t timestamp;      // Segundos desde la época Unix (UTC)
+    double microSieverts;   // Dosis recibida en el evento
+};
+
+// Registro de dosis por trabajador. Los eventos se guardan comprimidos
+// (marcas de tiempo en deltas y dosis cuantizada, ambos en varint) y los
+// totales de los últimos 12 meses naturales y del año en curso se
+// mantienen de forma incremental, así que la consulta de horas restantes
+// es O(1) para fechas posteriores al último evento. Las consultas
+// históricas (fecha anterior al último evento) se recalculan
+// decodificando los eventos hasta esa fecha y cuestan O(eventos).
+class DoseLedger {
+public:
+    static const uint64_t DOSE_QUANTUM_NSV = 10;  // Resolución: 0.01 μSv
+
+    DoseLedger();
+
+    // Trabajadores
+    int registerWorker(const std::string& workerId);
+    int findWorker(const std::string& workerId);
+    size_t getWorkerCount();
+
+    // Límite anual aplicado (μSv); por defecto el del público
+    void setAnnualLimit(double microSieverts);
+    double getAnnualLimit();
+
+    // Registro de exposiciones (en orden cronológico por trabajador)
+    bool addExposure(int workerIndex, int64_t timestamp, double microSieverts);
+    std::vector<ExposureEvent> getEvents(int workerIndex);
+    size_t getStorageBytes(int workerIndex);
+
+    // Totales a una fecha dada
+    double getRollingTotal(int workerIndex, int64_t asOfTimestamp);
+    double getCalendarYearTotal(int workerIndex, int64_t asOfTimestamp);
+
+    // Horas seguras restantes a una tasa dada. En el lote, un índice no
+    // registrado o una tasa NaN dan NaN; una tasa <= 0 da un año completo
+    double getRemainingSafeHours(int workerIndex, double microSievertsPerHour, int64_t asOfTimestamp);
+    void getRemainingSafeHoursBatch(const uint32_t* workerIndices, const double* microSievertsPerHour,
+                                    size_t count, int64_t asOfTimestamp, double* outHours);
+
+    // Utilidad: índice de mes (año * 12 + mes - 1) de una marca de tiempo UTC
+    static int32_t monthIndexOf(int64_t timestamp);
+
+private:
+    static const int ROLLING_MONTHS = 12;
+
+    struct WorkerLedger {
+        std::vector<uint8_t> encodedEvents;
+        int64_t lastTimestamp;
+        uint32_t eventCount;
+        int32_t currentMonth;                 // Mes del último evento
+        uint64_t monthlyQuanta[ROLLING_MONTHS];  // Anillo indexado por mes % 12
+        uint64_t rollingQuanta;               // Suma del anillo
+        uint64_t yearQuanta;                  // Total del año natural de currentMonth
+    };
+
+    std::vector<WorkerLedger> workers;
+    std::unordered_map<std::string, int> workerIndexById;
+    double annualLimitQuanta;
+
+    static void advanceMonth(WorkerLedger& ledger, int32_t month);
+    static void quantaAsOf(const WorkerLedger& ledger, int64_t asOfTimestamp,
+                           uint64_t& rollingQuanta, uint64_t& yearQuanta);
+    static void putVarint(std::vector<uint8_t>& out, uint64_t value);
+    static uint64_t readVarint(const uint8_t*& p);
+};
+
+#endif // DOSELEDGER_H
@@ -0,0 +1,56 @@
+#ifndef DOSERESPONSEMODEL_H
+#define DOSERESPONSEMODEL_H
+
+#include <cstddef>
+#include <vector>
+
+enum class DoseResponseForm {
+    PROBIT,     // Mortalidad = Φ(pendiente · ln(D / LD50))
+    LOGISTIC    // Mortalidad = 1 / (1 + (LD50 / D)^pendiente)
+};
+
+struct DoseResponseParameters {
+    DoseResponseForm form;
+    double ld50Sieverts;   // Dosis letal media
+    double slope;          // Pendiente en escala logarítmica de dosis
+    double maxSurvival;    // % de supervivencia a dosis nula
+    double minSurvival;    // % de supervivencia asintótico a dosis muy altas
+};
+
+// Modelo continuo dosis-respuesta, alternativo a la tabla escalonada de
+// HealthEffectAnalyzer::getSurvivalProbability. La versión escalar usa
+// <cmath> y sirve de referencia; la versión por lotes usa aproximaciones
+// rápidas sin ramas de exp/log/erf que el compilador puede vectorizar.
+class DoseResponseModel {
+public:
+    // Cota del error absoluto del lote frente a la referencia, en puntos porcentuales
+    static constexpr double MAX_BATCH_ERROR = 1e-4;
+
+    DoseResponseModel();
+
+    // Parámetros de las curvas sin y con tratamiento
+    void setParameters(bool withTreatment, const DoseResponseParameters& parameters);
+    const DoseResponseParameters& getParameters(bool withTreatment);
+    static DoseResponseParameters getDefaultParameters(bool withTreatment);
+
+    // Supervivencia (%) para una dosis total en μSv
+    double getSurvivalProbability(double totalDoseMicroSieverts, bool withTreatment = false);
+    void getSurvivalProbabilityBatch(const double* totalDoseMicroSieverts, size_t count,
+                                     bool withTreatment, double* outSurvival);
+    std::vector<double> getSurvivalProbabilityBatch(const std::vector<double>& totalDoseMicroSieverts,
+                                                    bool withTreatment = false);
+
+    // Error absoluto máximo del lote frente a la referencia escalar
+    double measureBatchError(const std::vector<double>& totalDoseMicroSieverts, bool withTreatment);
+
+    // Aproximaciones rápidas (|error relativo| < 1e-9 en exp/log, < 1.5e-7 absoluto en erf)
+    static double fastExp(double x);
+    static double fastLog(double x);
+    static double fastErf(double x);
+
+private:
+    DoseResponseParameters untreated;
+    DoseResponseParameters treated;
+};
+
+#endif // DOSERESPONSEMODEL_H
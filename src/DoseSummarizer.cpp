@@ -0,0 +1,242 @@
+#include "DoseSummarizer.h"
+#include "PrecisionPolicy.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <thread>
+
+namespace {
+    struct Accumulator {
+        uint64_t levelCounts[5];
+        uint64_t invalid;
+        double levelHours[5];
+        double peak;
+        double integrated;
+    };
+
+    // Tabla hash de direccionamiento abierto con sondeo lineal. Las
+    // entradas (clave + posición, 16 bytes) van separadas de los
+    // acumuladores para que el sondeo recorra memoria contigua y pequeña
+    class GroupTable {
+    public:
+        GroupTable() : bits(10) {
+            entries.assign(size_t(1) << bits, { 0, EMPTY });
+        }
+
+        Accumulator& get(uint64_t key) {
+            size_t mask = entries.size() - 1;
+            size_t index = hash(key);
+            while (entries[index].slot != EMPTY) {
+                if (entries[index].key == key) {
+                    return accumulators[entries[index].slot];
+                }
+                index = (index + 1) & mask;
+            }
+
+            // Factor de carga máximo 1/2
+            if ((groupKeys.size() + 1) * 2 > entries.size()) {
+                grow();
+                return get(key);
+            }
+            entries[index] = { key, static_cast<uint32_t>(groupKeys.size()) };
+            groupKeys.push_back(key);
+            accumulators.push_back(Accumulator());
+            return accumulators.back();
+        }
+
+        void mergeFrom(const GroupTable& other) {
+            for (size_t i = 0; i < other.groupKeys.size(); ++i) {
+                const Accumulator& source = other.accumulators[i];
+                Accumulator& target = get(other.groupKeys[i]);
+                for (int l = 0; l < 5; ++l) {
+                    target.levelCounts[l] += source.levelCounts[l];
+                    target.levelHours[l] += source.levelHours[l];
+                }
+                target.invalid += source.invalid;
+                target.peak = std::max(target.peak, source.peak);
+                target.integrated += source.integrated;
+            }
+        }
+
+        size_t size() const { return groupKeys.size(); }
+        uint64_t keyAt(size_t index) const { return groupKeys[index]; }
+        const Accumulator& accumulatorAt(size_t index) const { return accumulators[index]; }
+
+    private:
+        static const uint32_t EMPTY = UINT32_MAX;
+
+        struct Entry {
+            uint64_t key;
+            uint32_t slot;
+        };
+
+        int bits;
+        std::vector<Entry> entries;
+        std::vector<uint64_t> groupKeys;
+        std::vector<Accumulator> accumulators;
+
+        size_t hash(uint64_t key) const {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+        }
+
+        void grow() {
+            ++bits;
+            entries.assign(size_t(1) << bits, { 0, EMPTY });
+            size_t mask = entries.size() - 1;
+            for (size_t slot = 0; slot < groupKeys.size(); ++slot) {
+                size_t index = hash(groupKeys[slot]);
+                while (entries[index].slot != EMPTY) {
+                    index = (index + 1) & mask;
+                }
+                entries[index] = { groupKeys[slot], static_cast<uint32_t>(slot) };
+            }
+        }
+    };
+
+    uint64_t makeKey(uint32_t siteId, uint32_t sensorId) {
+        return (static_cast<uint64_t>(siteId) << 32) | sensorId;
+    }
+
+    // Devuelve false si encuentra el sensorId reservado al agrupar por sensor
+    bool summarizeRange(const SummaryInput& input, bool bySite, size_t blockSize,
+                        size_t begin, size_t end, GroupTable& table) {
+        std::vector<DangerLevel> levels(blockSize);
+        uint64_t lastKey = 0;
+        Accumulator* current = nullptr;
+
+        for (size_t blockStart = begin; blockStart < end; blockStart += blockSize) {
+            size_t n = std::min(blockSize, end - blockStart);
+            const double* rates = input.microSievertsPerHour + blockStart;
+
+            // Clasificación del bloque con el núcleo vectorizable
+            classifyKernel<DoublePrecision>(rates, n, levels.data());
+
+            for (size_t i = 0; i < n; ++i) {
+                size_t row = blockStart + i;
+                uint32_t site = input.siteIds ? input.siteIds[row] : 0;
+                uint32_t sensor = bySite ? DoseSummarizer::ALL_SENSORS : input.sensorIds[row];
+                if (!bySite && sensor == DoseSummarizer::ALL_SENSORS) return false;
+                uint64_t key = makeKey(site, sensor);
+
+                // Las lecturas de un mismo sensor suelen venir seguidas
+                if (!current || key != lastKey) {
+                    current = &table.get(key);
+                    lastKey = key;
+                }
+
+                double hours = input.durationHours ? input.durationHours[row] : input.defaultDurationHours;
+                double rate = rates[i];
+                if (!std::isfinite(rate) || !std::isfinite(hours)) {
+                    current->invalid++;
+                    continue;
+                }
+
+                int level = static_cast<int>(levels[i]);
+                current->levelCounts[level]++;
+                current->levelHours[level] += hours;
+                current->peak = rate > current->peak ? rate : current->peak;
+                current->integrated += rate * hours;
+            }
+        }
+        return true;
+    }
+}
+
+DoseSummarizer::DoseSummarizer() : lastWorkerCount(0), lastElapsedSeconds(0.0) {
+}
+
+std::vector<DoseSummary> DoseSummarizer::summarize(const SummaryInput& input, const SummaryOptions& options) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<DoseSummary> summaries;
+    if (input.count == 0 || !input.microSievertsPerHour) return summaries;
+
+    bool bySite = options.grouping == SummaryGrouping::BY_SITE;
+    if (!bySite && !input.sensorIds) return summaries;
+
+    size_t blockSize = std::max<size_t>(1, options.blockSize);
+    unsigned workers = options.workerThreads ? options.workerThreads : std::max(1u, std::thread::hardware_concurrency());
+    workers = static_cast<unsigned>(std::min<size_t>(workers, (input.count + blockSize - 1) / blockSize));
+
+    // Una tabla parcial por hilo: sin bloqueos ni compartición durante la reducción
+    std::vector<GroupTable> partials(workers);
+    std::vector<char> accepted(workers, 1);
+    std::vector<std::future<void>> tasks;
+    size_t perWorker = (input.count + workers - 1) / workers;
+    for (unsigned w = 0; w < workers; ++w) {
+        size_t begin = std::min(input.count, w * perWorker);
+        size_t end = std::min(input.count, begin + perWorker);
+        GroupTable* table = &partials[w];
+        char* workerAccepted = &accepted[w];
+        tasks.push_back(std::async(std::launch::async, [&input, bySite, blockSize, begin, end, table, workerAccepted]() {
+            *workerAccepted = summarizeRange(input, bySite, blockSize, begin, end, *table);
+        }));
+    }
+    for (std::future<void>& task : tasks) {
+        task.get();
+    }
+
+    // El sensor reservado se detecta en el propio recorrido, sin una
+    // pasada previa en serie sobre toda la entrada
+    if (std::find(accepted.begin(), accepted.end(), 0) != accepted.end()) {
+        return summaries;
+    }
+
+    GroupTable& merged = partials[0];
+    for (unsigned w = 1; w < workers; ++w) {
+        merged.mergeFrom(partials[w]);
+    }
+
+    summaries.reserve(merged.size());
+    for (size_t i = 0; i < merged.size(); ++i) {
+        const Accumulator& accumulator = merged.accumulatorAt(i);
+        DoseSummary summary = {};
+        summary.siteId = static_cast<uint32_t>(merged.keyAt(i) >> 32);
+        summary.sensorId = static_cast<uint32_t>(merged.keyAt(i));
+
+        // Superar el umbral j equivale a tener un nivel mayor que j
+        uint64_t above = 0;
+        for (int level = 4; level >= 0; --level) {
+            summary.records += accumulator.levelCounts[level];
+            summary.hoursInLevel[level] = accumulator.levelHours[level];
+            if (level < 4) {
+                above += accumulator.levelCounts[level + 1];
+                summary.exceedances[level] = above;
+            }
+        }
+        summary.invalidRecords = accumulator.invalid;
+        summary.peakMicroSievertsPerHour = accumulator.peak;
+        summary.integratedMicroSieverts = accumulator.integrated;
+        summaries.push_back(summary);
+    }
+    std::sort(summaries.begin(), summaries.end(), [](const DoseSummary& a, const DoseSummary& b) {
+        return makeKey(a.siteId, a.sensorId) < makeKey(b.siteId, b.sensorId);
+    });
+
+    lastWorkerCount = workers;
+    lastElapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summaries;
+}
+
+DoseSummary DoseSummarizer::combineAll(const std::vector<DoseSummary>& summaries) {
+    DoseSummary total = {};
+    total.siteId = ALL_SENSORS;
+    total.sensorId = ALL_SENSORS;
+    for (const DoseSummary& summary : summaries) {
+        total.records += summary.records;
+        total.invalidRecords += summary.invalidRecords;
+        for (int l = 0; l < 5; ++l) total.hoursInLevel[l] += summary.hoursInLevel[l];
+        for (int j = 0; j < 4; ++j) total.exceedances[j] += summary.exceedances[j];
+        total.peakMicroSievertsPerHour = std::max(total.peakMicroSievertsPerHour, summary.peakMicroSievertsPerHour);
+        total.integratedMicroSieverts += summary.integratedMicroSieverts;
+    }
+    return total;
+}
+
+unsigned DoseSummarizer::getLastWorkerCount() {
+    return lastWorkerCount;
+}
+
+double DoseSummarizer::getLastElapsedSeconds() {
+    return lastElapsedSeconds;
+}
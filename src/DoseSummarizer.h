@@ -0,0 +1,70 @@
+#ifndef DOSESUMMARIZER_H
+#define DOSESUMMARIZER_H
+
+#include "RadiationCalculator.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Columnas de entrada (estructura de arrays, sin copiar)
+struct SummaryInput {
+    size_t count = 0;
+    const uint32_t* siteIds = nullptr;
+    const uint32_t* sensorIds = nullptr;          // ALL_SENSORS está reservado
+    const double* microSievertsPerHour = nullptr;
+    const double* durationHours = nullptr;      // nullptr: defaultDurationHours para todas
+    double defaultDurationHours = 1.0 / 60.0;   // Lectura por minuto
+};
+
+enum class SummaryGrouping {
+    BY_SENSOR,   // Clave (sitio, sensor)
+    BY_SITE
+};
+
+struct SummaryOptions {
+    SummaryGrouping grouping = SummaryGrouping::BY_SENSOR;
+    unsigned workerThreads = 0;     // 0 = std::thread::hardware_concurrency()
+    size_t blockSize = 4096;        // Lecturas clasificadas por bloque
+};
+
+struct DoseSummary {
+    uint32_t siteId;
+    uint32_t sensorId;               // ALL_SENSORS al agrupar por sitio
+    uint64_t records;                // Lecturas válidas
+    uint64_t invalidRecords;         // Descartadas por tasa o duración no finita
+    double hoursInLevel[5];          // Indexado por DangerLevel
+    uint64_t exceedances[4];         // Lecturas >= cada umbral de RadiationCalculator::DANGER_THRESHOLDS
+    double peakMicroSievertsPerHour;
+    double integratedMicroSieverts;
+};
+
+// Resumen para informes de cumplimiento: tiempo en cada nivel de peligro,
+// superaciones de umbral, pico y dosis integrada por sensor o por sitio.
+// Cada hilo reduce su tramo en una tabla hash propia de direccionamiento
+// abierto; las tablas parciales se combinan al final.
+//
+// Las lecturas con tasa o duración no finita no entran en niveles,
+// superaciones, pico ni dosis integrada: solo cuentan en invalidRecords.
+// Al agrupar por sensor, un sensorId igual a ALL_SENSORS se confundiría
+// con el agregado por sitio, así que la entrada se rechaza (resultado vacío).
+class DoseSummarizer {
+public:
+    static const uint32_t ALL_SENSORS = UINT32_MAX;
+
+    DoseSummarizer();
+
+    // Resultados ordenados por (sitio, sensor)
+    std::vector<DoseSummary> summarize(const SummaryInput& input, const SummaryOptions& options = SummaryOptions());
+
+    // Total de todos los grupos
+    static DoseSummary combineAll(const std::vector<DoseSummary>& summaries);
+
+    unsigned getLastWorkerCount();
+    double getLastElapsedSeconds();
+
+private:
+    unsigned lastWorkerCount;
+    double lastElapsedSeconds;
+};
+
+#endif // DOSESUMMARIZER_H
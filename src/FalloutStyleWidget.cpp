@@ -1,4 +1,7 @@
 #include "FalloutStyleWidget.h"
+#include "DangerLevelBridge.h"
+#include "Instrumentation.h"
+#include <QApplication>
 #include <QPainter>
 #include <QGraphicsDropShadowEffect>
 #include <QPropertyAnimation>
@@ -11,6 +14,80 @@ const QString FalloutStyleWidget::FALLOUT_YELLOW = "#FFFF00";
 const QString FalloutStyleWidget::FALLOUT_ORANGE = "#FF8C00";
 const QString FalloutStyleWidget::FALLOUT_RED = "#FF0000";
 
+bool FalloutStyleWidget::applicationStyleInstalled = false;
+
+namespace {
+    // Propiedad dinámica que marca los widgets con estilo Fallout
+    const char* FALLOUT_STYLE_PROPERTY = "falloutStyle";
+
+    // Restringe cada regla de la hoja a los widgets marcados y a sus hijos,
+    // igual que cuando la hoja se aplicaba widget a widget:
+    // "QPushButton:hover" pasa a ser
+    // "QPushButton[falloutStyle=\"true\"]:hover, *[falloutStyle=\"true\"] QPushButton:hover"
+    QString scopeToFalloutWidgets(const QString& styleSheet) {
+        const QString marker = QString("[%1=\"true\"]").arg(FALLOUT_STYLE_PROPERTY);
+        QString scoped;
+        for (const QString& block : styleSheet.split('}', Qt::SkipEmptyParts)) {
+            int brace = block.indexOf('{');
+            if (brace < 0) continue;
+
+            QString selector = block.left(brace).trimmed();
+            int pseudo = selector.indexOf(':');
+            QString type = pseudo < 0 ? selector : selector.left(pseudo);
+            QString suffix = pseudo < 0 ? QString() : selector.mid(pseudo);
+            scoped += type + marker + suffix + ", *" + marker + " " + selector + " " + block.mid(brace) + "}";
+        }
+        return scoped;
+    }
+
+    // Hojas de estilo prearmadas, una por color de peligro
+    template <int N>
+    class DangerStyleSheets {
+    public:
+        template <typename Builder, typename ColorForIndex>
+        DangerStyleSheets(Builder build, ColorForIndex colorFor) {
+            for (int i = 0; i < N; ++i) {
+                sheets[i] = build(colorFor(i));
+            }
+        }
+        const QString& get(int index) const { return sheets[index]; }
+
+    private:
+        QString sheets[N];
+    };
+
+    QString buildButtonStyleSheet(const QString& color) {
+        return
+            "QPushButton {"
+            "   background-color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
+            "   color: " + color + ";"
+            "   border: 2px solid " + color + ";"
+            "   padding: 8px 16px;"
+            "   font-family: 'Courier New', monospace;"
+            "   font-weight: bold;"
+            "}"
+            "QPushButton:hover {"
+            "   background-color: " + color + ";"
+            "   color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
+            "}";
+    }
+
+    QString buildProgressBarStyleSheet(const QString& color) {
+        return
+            "QProgressBar {"
+            "   background-color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
+            "   border: 2px solid " + FalloutStyleWidget::FALLOUT_GREEN + ";"
+            "   text-align: center;"
+            "   font-family: 'Courier New', monospace;"
+            "   font-weight: bold;"
+            "   color: " + FalloutStyleWidget::FALLOUT_GREEN + ";"
+            "}"
+            "QProgressBar::chunk {"
+            "   background-color: " + color + ";"
+            "}";
+    }
+}
+
 FalloutStyleWidget::FalloutStyleWidget(QWidget *parent)
     : QWidget(parent), animationFrame(0) {
     setupAnimation();
@@ -19,8 +96,27 @@ FalloutStyleWidget::FalloutStyleWidget(QWidget *parent)
 
 void FalloutStyleWidget::applyFalloutStyle(QWidget* widget) {
     if (!widget) return;
+    RADMON_SCOPED_TIMER("applyFalloutStyle");
+    
+    // Con la hoja instalada a nivel de aplicación basta con marcar el
+    // widget: sus reglas solo afectan a los marcados y a sus hijos
+    widget->setProperty(FALLOUT_STYLE_PROPERTY, true);
+    if (!applicationStyleInstalled) {
+        widget->setStyleSheet(getFalloutStyleSheet());
+    }
     
-    widget->setStyleSheet(
+    applyTerminalFont(widget);
+}
+
+void FalloutStyleWidget::installApplicationStyle(QApplication* app) {
+    if (!app) return;
+    static const QString applicationStyleSheet = scopeToFalloutWidgets(getFalloutStyleSheet());
+    app->setStyleSheet(applicationStyleSheet);
+    applicationStyleInstalled = true;
+}
+
+const QString& FalloutStyleWidget::getFalloutStyleSheet() {
+    static const QString styleSheet =
         "QWidget {"
         "   background-color: " + FALLOUT_BLACK + ";"
         "   color: " + FALLOUT_GREEN + ";"
@@ -73,10 +169,8 @@ void FalloutStyleWidget::applyFalloutStyle(QWidget* widget) {
         "}"
         "QProgressBar::chunk {"
         "   background-color: " + FALLOUT_GREEN + ";"
-        "}"
-    );
-    
-    applyTerminalFont(widget);
+        "}";
+    return styleSheet;
 }
 
 void FalloutStyleWidget::applyTerminalFont(QWidget* widget) {
@@ -90,6 +184,11 @@ QFont FalloutStyleWidget::getTerminalFont() {
 }
 
 void FalloutStyleWidget::paintEvent(QPaintEvent* event) {
+    RADMON_SCOPED_TIMER("FalloutStyleWidget::paintEvent");
+#ifdef RADMON_INSTRUMENTATION
+    QElapsedTimer paintClock;
+    paintClock.start();
+#endif
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
     
@@ -101,7 +200,40 @@ void FalloutStyleWidget::paintEvent(QPaintEvent* event) {
     }
     
     QWidget::paintEvent(event);
+    
+#ifdef RADMON_INSTRUMENTATION
+    if (frameOverlayEnabled) {
+        drawFrameTimeOverlay(painter, paintClock.nsecsElapsed());
+    }
+#endif
+}
+
+#ifdef RADMON_INSTRUMENTATION
+void FalloutStyleWidget::setFrameTimeOverlay(bool enabled) {
+    frameOverlayEnabled = enabled;
+    frameClock.invalidate();
+    update();
+}
+
+void FalloutStyleWidget::drawFrameTimeOverlay(QPainter& painter, qint64 paintNanoseconds) {
+    // Media móvil exponencial para que el texto no parpadee entre frames
+    if (frameClock.isValid()) {
+        double interval = frameClock.nsecsElapsed() / 1000000.0;
+        if (interval > 0.0) {
+            double fps = 1000.0 / interval;
+            framesPerSecond = framesPerSecond > 0.0 ? 0.9 * framesPerSecond + 0.1 * fps : fps;
+        }
+    }
+    frameClock.start();
+    frameTimeMs = 0.9 * frameTimeMs + 0.1 * (paintNanoseconds / 1000000.0);
+    
+    painter.setOpacity(1.0);
+    painter.setPen(QColor(FALLOUT_YELLOW));
+    painter.setFont(getTerminalFont());
+    painter.drawText(rect().adjusted(4, 4, -4, -4), Qt::AlignTop | Qt::AlignRight,
+        QString("%1 ms | %2 FPS").arg(frameTimeMs, 0, 'f', 2).arg(framesPerSecond, 0, 'f', 1));
 }
+#endif
 
 void FalloutStyleWidget::setupAnimation() {
     animationTimer = new QTimer(this);
@@ -143,6 +275,13 @@ void FalloutLabel::setBlinking(bool enabled) {
     }
 }
 
+#ifdef RADMON_INSTRUMENTATION
+void FalloutLabel::paintEvent(QPaintEvent* event) {
+    RADMON_SCOPED_TIMER("FalloutLabel::paintEvent");
+    QLabel::paintEvent(event);
+}
+#endif
+
 void FalloutLabel::setupBlinking() {
     blinkTimer = new QTimer(this);
     connect(blinkTimer, &QTimer::timeout, this, &FalloutLabel::onBlinkTimer);
@@ -155,36 +294,27 @@ void FalloutLabel::onBlinkTimer() {
 
 // FalloutButton Implementation
 FalloutButton::FalloutButton(const QString& text, QWidget* parent)
-    : QPushButton(text, parent), isHovered(false) {
+    : QPushButton(text, parent), dangerLevel(DangerLevel::SAFE), dangerStyleApplied(false), isHovered(false) {
     FalloutStyleWidget::applyFalloutStyle(this);
 }
 
-void FalloutButton::setDangerLevel(const QString& level) {
+void FalloutButton::setDangerLevel(DangerLevel level) {
+    if (dangerStyleApplied && level == dangerLevel) return;
     dangerLevel = level;
-    QString color = getDangerColor(level);
-    
-    setStyleSheet(
-        "QPushButton {"
-        "   background-color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
-        "   color: " + color + ";"
-        "   border: 2px solid " + color + ";"
-        "   padding: 8px 16px;"
-        "   font-family: 'Courier New', monospace;"
-        "   font-weight: bold;"
-        "}"
-        "QPushButton:hover {"
-        "   background-color: " + color + ";"
-        "   color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
-        "}"
-    );
+    dangerStyleApplied = true;
+    setStyleSheet(getDangerStyleSheet(level));
+}
+
+void FalloutButton::setDangerLevel(const QString& level) {
+    setDangerLevel(DangerLevelBridge::fromLevelName(level));
 }
 
-QString FalloutButton::getDangerColor(const QString& level) {
-    if (level == "SAFE") return FalloutStyleWidget::FALLOUT_GREEN;
-    if (level == "CAUTION") return FalloutStyleWidget::FALLOUT_YELLOW;
-    if (level == "DANGEROUS") return FalloutStyleWidget::FALLOUT_ORANGE;
-    if (level == "EXTREME" || level == "LETHAL") return FalloutStyleWidget::FALLOUT_RED;
-    return FalloutStyleWidget::FALLOUT_GREEN;
+const QString& FalloutButton::getDangerStyleSheet(DangerLevel level) {
+    // Una hoja de estilo prearmada por nivel, compartida por todos los botones
+    static const DangerStyleSheets<DangerLevelBridge::LEVEL_COUNT> sheets(buildButtonStyleSheet, [](int i) {
+        return DangerLevelBridge::getDangerColorName(static_cast<DangerLevel>(i));
+    });
+    return sheets.get(static_cast<int>(level));
 }
 
 void FalloutButton::enterEvent(QEvent* event) {
@@ -198,19 +328,20 @@ void FalloutButton::leaveEvent(QEvent* event) {
 }
 
 void FalloutButton::paintEvent(QPaintEvent* event) {
+    RADMON_SCOPED_TIMER("FalloutButton::paintEvent");
     QPushButton::paintEvent(event);
     
     if (isHovered) {
         QPainter painter(this);
         painter.setRenderHint(QPainter::Antialiasing);
-        painter.setPen(QPen(QColor(getDangerColor(dangerLevel)), 2));
+        painter.setPen(QPen(DangerLevelBridge::getDangerColor(dangerLevel), 2));
         painter.drawRect(rect().adjusted(1, 1, -1, -1));
     }
 }
 
 // FalloutProgressBar Implementation
 FalloutProgressBar::FalloutProgressBar(QWidget* parent)
-    : QProgressBar(parent), currentAnimatedValue(0), targetAnimatedValue(0) {
+    : QProgressBar(parent), currentAnimatedValue(0), targetAnimatedValue(0), dangerBand(-1) {
     FalloutStyleWidget::applyFalloutStyle(this);
     
     animationTimer = new QTimer(this);
@@ -219,25 +350,25 @@ FalloutProgressBar::FalloutProgressBar(QWidget* parent)
 }
 
 void FalloutProgressBar::setDangerLevel(int percentage) {
-    QString color = FalloutStyleWidget::FALLOUT_GREEN;
-    
-    if (percentage > 90) color = FalloutStyleWidget::FALLOUT_RED;
-    else if (percentage > 70) color = FalloutStyleWidget::FALLOUT_ORANGE;
-    else if (percentage > 40) color = FalloutStyleWidget::FALLOUT_YELLOW;
+    int band = 0;
+    if (percentage > 90) band = 3;
+    else if (percentage > 70) band = 2;
+    else if (percentage > 40) band = 1;
     
-    setStyleSheet(
-        "QProgressBar {"
-        "   background-color: " + FalloutStyleWidget::FALLOUT_BLACK + ";"
-        "   border: 2px solid " + FalloutStyleWidget::FALLOUT_GREEN + ";"
-        "   text-align: center;"
-        "   font-family: 'Courier New', monospace;"
-        "   font-weight: bold;"
-        "   color: " + FalloutStyleWidget::FALLOUT_GREEN + ";"
-        "}"
-        "QProgressBar::chunk {"
-        "   background-color: " + color + ";"
-        "}"
-    );
+    if (band == dangerBand) return;
+    dangerBand = band;
+    setStyleSheet(getDangerStyleSheet(band));
+}
+
+const QString& FalloutProgressBar::getDangerStyleSheet(int band) {
+    static const DangerStyleSheets<4> sheets(buildProgressBarStyleSheet, [](int i) {
+        const QString* colors[] = {
+            &FalloutStyleWidget::FALLOUT_GREEN, &FalloutStyleWidget::FALLOUT_YELLOW,
+            &FalloutStyleWidget::FALLOUT_ORANGE, &FalloutStyleWidget::FALLOUT_RED
+        };
+        return *colors[i];
+    });
+    return sheets.get(band);
 }
 
 void FalloutProgressBar::animateToValue(int targetValue) {
@@ -246,6 +377,13 @@ void FalloutProgressBar::animateToValue(int targetValue) {
     animationTimer->start(50);
 }
 
+#ifdef RADMON_INSTRUMENTATION
+void FalloutProgressBar::paintEvent(QPaintEvent* event) {
+    RADMON_SCOPED_TIMER("FalloutProgressBar::paintEvent");
+    QProgressBar::paintEvent(event);
+}
+#endif
+
 void FalloutProgressBar::onAnimationStep() {
     if (currentAnimatedValue < targetAnimatedValue) {
         currentAnimatedValue = std::min(currentAnimatedValue + animationStep, targetAnimatedValue);
@@ -297,6 +435,13 @@ void FalloutTextDisplay::clearWithEffect() {
     }
 }
 
+#ifdef RADMON_INSTRUMENTATION
+void FalloutTextDisplay::paintEvent(QPaintEvent* event) {
+    RADMON_SCOPED_TIMER("FalloutTextDisplay::paintEvent");
+    QTextEdit::paintEvent(event);
+}
+#endif
+
 void FalloutTextDisplay::setupTypewriter() {
     typewriterTimer = new QTimer(this);
     connect(typewriterTimer, &QTimer::timeout, this, &FalloutTextDisplay::onTypewriterTimer);
@@ -8,6 +8,12 @@
 #include <QProgressBar>
 #include <QTimer>
 #include <QFont>
+#include "RadiationCalculator.h"
+#ifdef RADMON_INSTRUMENTATION
+#include <QElapsedTimer>
+#endif
+
+class QApplication;
 
 class FalloutStyleWidget : public QWidget {
     Q_OBJECT
@@ -20,6 +26,11 @@ public:
     static void applyTerminalFont(QWidget* widget);
     static QFont getTerminalFont();
     
+    // Instala la hoja de estilo una sola vez para toda la aplicación,
+    // restringida a los widgets pasados por applyFalloutStyle
+    static void installApplicationStyle(QApplication* app);
+    static const QString& getFalloutStyleSheet();
+    
     // Colores del tema
     static const QString FALLOUT_GREEN;
     static const QString FALLOUT_BLACK;
@@ -27,6 +38,11 @@ public:
     static const QString FALLOUT_ORANGE;
     static const QString FALLOUT_RED;
     
+#ifdef RADMON_INSTRUMENTATION
+    // Superposición de tiempo de frame / FPS
+    void setFrameTimeOverlay(bool enabled);
+#endif
+    
 protected:
     void paintEvent(QPaintEvent* event) override;
 
@@ -34,9 +50,20 @@ private slots:
     void onAnimationTimer();
 
 private:
+    static bool applicationStyleInstalled;
+    
     QTimer* animationTimer;
     int animationFrame;
     
+#ifdef RADMON_INSTRUMENTATION
+    bool frameOverlayEnabled = false;
+    QElapsedTimer frameClock;
+    double frameTimeMs = 0.0;
+    double framesPerSecond = 0.0;
+    
+    void drawFrameTimeOverlay(QPainter& painter, qint64 paintNanoseconds);
+#endif
+    
     void setupAnimation();
 };
 
@@ -48,6 +75,11 @@ public:
     void setGlowEffect(bool enabled);
     void setBlinking(bool enabled);
 
+#ifdef RADMON_INSTRUMENTATION
+protected:
+    void paintEvent(QPaintEvent* event) override;
+#endif
+
 private slots:
     void onBlinkTimer();
 
@@ -64,6 +96,7 @@ class FalloutButton : public QPushButton {
 
 public:
     explicit FalloutButton(const QString& text = "", QWidget* parent = nullptr);
+    void setDangerLevel(DangerLevel level);
     void setDangerLevel(const QString& level); // "SAFE", "CAUTION", "DANGEROUS", "EXTREME", "LETHAL"
 
 protected:
@@ -72,10 +105,11 @@ protected:
     void paintEvent(QPaintEvent* event) override;
 
 private:
-    QString dangerLevel;
+    DangerLevel dangerLevel;
+    bool dangerStyleApplied;
     bool isHovered;
     
-    QString getDangerColor(const QString& level);
+    static const QString& getDangerStyleSheet(DangerLevel level);
 };
 
 class FalloutProgressBar : public QProgressBar {
@@ -86,6 +120,11 @@ public:
     void setDangerLevel(int percentage);
     void animateToValue(int targetValue);
 
+#ifdef RADMON_INSTRUMENTATION
+protected:
+    void paintEvent(QPaintEvent* event) override;
+#endif
+
 private slots:
     void onAnimationStep();
 
@@ -94,6 +133,9 @@ private:
     int currentAnimatedValue;
     int targetAnimatedValue;
     int animationStep;
+    int dangerBand;
+    
+    static const QString& getDangerStyleSheet(int band);
 };
 
 class FalloutTextDisplay : public QTextEdit {
@@ -108,6 +150,11 @@ public:
 public slots:
     void clearWithEffect();
 
+#ifdef RADMON_INSTRUMENTATION
+protected:
+    void paintEvent(QPaintEvent* event) override;
+#endif
+
 private slots:
     void onTypewriterTimer();
 
@@ -1,4 +1,5 @@
 #include "HealthEffectAnalyzer.h"
+#include "Instrumentation.h"
 #include <cmath>
 #include <sstream>
 #include <iomanip>
@@ -8,6 +9,7 @@ HealthEffectAnalyzer::HealthEffectAnalyzer() {
 }
 
 HealthEffects HealthEffectAnalyzer::analyzeEffects(double microSieverts, double exposureHours) {
+    RADMON_SCOPED_TIMER("analyzeEffects");
     HealthEffects effects;
     RadiationCalculator calc;
     
@@ -144,6 +146,15 @@ double HealthEffectAnalyzer::getSurvivalProbability(double totalDose, bool withT
     }
 }
 
+double HealthEffectAnalyzer::getContinuousSurvivalProbability(double totalDose, bool withTreatment) {
+    // Curva continua (probit LD50) sin los saltos de la tabla escalonada
+    return doseResponse.getSurvivalProbability(totalDose, withTreatment);
+}
+
+DoseResponseModel& HealthEffectAnalyzer::getDoseResponseModel() {
+    return doseResponse;
+}
+
 std::string HealthEffectAnalyzer::getMedicalClassification(double microSieverts) {
     if (microSieverts < 2.0) {
         return "Sin síndrome de radiación";
@@ -175,6 +186,7 @@ std::string HealthEffectAnalyzer::getEmergencyProtocol(DangerLevel level) {
 }
 
 std::string HealthEffectAnalyzer::formatHealthEffectsReport(const HealthEffects& effects) {
+    RADMON_SCOPED_TIMER("formatHealthEffectsReport");
     std::ostringstream report;
     
     report << "ANÁLISIS MÉDICO\n";
@@ -2,6 +2,7 @@
 #define HEALTHEFFECTANALYZER_H
 
 #include "RadiationCalculator.h"
+#include "DoseResponseModel.h"
 #include <string>
 #include <vector>
 
@@ -36,6 +37,8 @@ public:
     
     // Análisis de supervivencia
     double getSurvivalProbability(double totalDose, bool withTreatment = false);
+    double getContinuousSurvivalProbability(double totalDose, bool withTreatment = false);
+    DoseResponseModel& getDoseResponseModel();
     
     // Clasificación médica
     std::string getMedicalClassification(double microSieverts);
@@ -50,6 +53,8 @@ public:
     std::string formatHealthEffectsReport(const HealthEffects& effects);
     
 private:
+    DoseResponseModel doseResponse;
+    
     void initializeEffectDatabase();
     double calculateAcuteDose(double microSieverts, double hours);
     std::string getSeverityColor(const std::string& severity);
@@ -0,0 +1,275 @@
+#include "Instrumentation.h"
+
+#ifdef RADMON_INSTRUMENTATION
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+    struct ThreadHistograms {
+        LatencyHistogram probes[Instrumentation::MAX_PROBES];
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::string probeNames[Instrumentation::MAX_PROBES];
+        std::atomic<int> probeCount{0};
+        std::vector<std::unique_ptr<ThreadHistograms>> threads;
+
+        std::thread exporter;
+        std::mutex exporterMutex;
+        std::condition_variable exporterWake;
+        bool exporterStop = false;
+
+        ~Registry() {
+            if (exporter.joinable()) {
+                {
+                    std::lock_guard<std::mutex> lock(exporterMutex);
+                    exporterStop = true;
+                }
+                exporterWake.notify_all();
+                exporter.join();
+            }
+        }
+    };
+
+    Registry& registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    // Los bloques de cada hilo viven en el registro para que sus datos
+    // sigan disponibles en la exportación cuando el hilo termina
+    ThreadHistograms* localHistograms() {
+        thread_local ThreadHistograms* local = nullptr;
+        if (!local) {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.threads.push_back(std::unique_ptr<ThreadHistograms>(new ThreadHistograms()));
+            local = reg.threads.back().get();
+        }
+        return local;
+    }
+
+    int highestBit(uint64_t value) {
+        int bit = 0;
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+    }
+
+    void bump(std::atomic<uint64_t>& counter, uint64_t amount) {
+        // Escritor único: carga + almacenamiento evita la instrucción atómica con bloqueo
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    bool endsWith(const std::string& text, const std::string& suffix) {
+        return text.size() >= suffix.size() &&
+               text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+}
+
+// LatencyHistogram Implementation
+LatencyHistogram::LatencyHistogram() : count(0), sum(0), max(0) {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) {
+    bump(buckets[bucketIndex(nanoseconds)], 1);
+    bump(count, 1);
+    bump(sum, nanoseconds);
+    if (nanoseconds > max.load(std::memory_order_relaxed)) {
+        max.store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+uint64_t LatencyHistogram::getCount() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getBucket(int index) const {
+    return buckets[index].load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getSum() const {
+    return sum.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const {
+    return max.load(std::memory_order_relaxed);
+}
+
+int LatencyHistogram::bucketIndex(uint64_t nanoseconds) {
+    if (nanoseconds < static_cast<uint64_t>(SUB_BUCKETS)) {
+        return static_cast<int>(nanoseconds);
+    }
+    int magnitude = highestBit(nanoseconds);
+    if (magnitude > MAX_MAGNITUDE) {
+        return BUCKET_COUNT - 1;
+    }
+    int sub = static_cast<int>((nanoseconds >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return (magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(int index) {
+    if (index < SUB_BUCKETS) {
+        return static_cast<uint64_t>(index);
+    }
+    int magnitude = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    uint64_t sub = static_cast<uint64_t>(index % SUB_BUCKETS);
+    return (SUB_BUCKETS + sub) << (magnitude - SUB_BUCKET_BITS);
+}
+
+// Instrumentation Implementation
+int Instrumentation::registerProbe(const char* name) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    int existing = reg.probeCount.load(std::memory_order_relaxed);
+    for (int i = 0; i < existing; ++i) {
+        if (reg.probeNames[i] == name) {
+            return i;
+        }
+    }
+    if (existing >= MAX_PROBES) {
+        return -1;
+    }
+
+    reg.probeNames[existing] = name;
+    reg.probeCount.store(existing + 1, std::memory_order_release);
+    return existing;
+}
+
+void Instrumentation::record(int probeId, uint64_t nanoseconds) {
+    if (probeId < 0) return;
+    localHistograms()->probes[probeId].record(nanoseconds);
+}
+
+std::vector<ProbeSummary> Instrumentation::snapshot() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    std::vector<ProbeSummary> summaries;
+    int probes = reg.probeCount.load(std::memory_order_acquire);
+    std::vector<uint64_t> merged(LatencyHistogram::BUCKET_COUNT);
+
+    for (int p = 0; p < probes; ++p) {
+        std::fill(merged.begin(), merged.end(), 0);
+        uint64_t total = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        for (const auto& thread : reg.threads) {
+            const LatencyHistogram& histogram = thread->probes[p];
+            for (int b = 0; b < LatencyHistogram::BUCKET_COUNT; ++b) {
+                uint64_t bucket = histogram.getBucket(b);
+                merged[b] += bucket;
+                total += bucket;
+            }
+            sum += histogram.getSum();
+            max = std::max(max, histogram.getMax());
+        }
+
+        ProbeSummary summary;
+        summary.name = reg.probeNames[p];
+        summary.count = total;
+        summary.meanMicroseconds = total ? (static_cast<double>(sum) / total) / 1000.0 : 0.0;
+        summary.maxMicroseconds = max / 1000.0;
+
+        // Percentiles: valor más alto equivalente de la cubeta, acotado por el máximo
+        double* targets[] = { &summary.p50Microseconds, &summary.p90Microseconds, &summary.p99Microseconds };
+        const double quantiles[] = { 0.50, 0.90, 0.99 };
+        for (int q = 0; q < 3; ++q) {
+            uint64_t rank = static_cast<uint64_t>(quantiles[q] * total);
+            uint64_t seen = 0;
+            int bucket = 0;
+            for (; bucket < LatencyHistogram::BUCKET_COUNT - 1; ++bucket) {
+                seen += merged[bucket];
+                if (seen > rank) break;
+            }
+            uint64_t upper = LatencyHistogram::bucketLowerBound(bucket + 1) - 1;
+            *targets[q] = total ? std::min(upper, max) / 1000.0 : 0.0;
+        }
+
+        summaries.push_back(summary);
+    }
+
+    return summaries;
+}
+
+bool Instrumentation::exportJson(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return false;
+
+    std::vector<ProbeSummary> summaries = snapshot();
+    out << std::fixed << std::setprecision(3);
+    out << "{\n  \"unit\": \"us\",\n  \"probes\": [\n";
+    for (size_t i = 0; i < summaries.size(); ++i) {
+        const ProbeSummary& s = summaries[i];
+        out << "    {\"name\": \"" << s.name << "\", \"count\": " << s.count
+            << ", \"mean\": " << s.meanMicroseconds
+            << ", \"p50\": " << s.p50Microseconds
+            << ", \"p90\": " << s.p90Microseconds
+            << ", \"p99\": " << s.p99Microseconds
+            << ", \"max\": " << s.maxMicroseconds << "}"
+            << (i + 1 < summaries.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+bool Instrumentation::exportCsv(const std::string& path) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return false;
+
+    out << std::fixed << std::setprecision(3);
+    out << "probe,count,mean_us,p50_us,p90_us,p99_us,max_us\n";
+    for (const auto& s : snapshot()) {
+        out << s.name << "," << s.count << "," << s.meanMicroseconds << ","
+            << s.p50Microseconds << "," << s.p90Microseconds << ","
+            << s.p99Microseconds << "," << s.maxMicroseconds << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+void Instrumentation::startPeriodicExport(const std::string& path, int intervalMs) {
+    stopPeriodicExport();
+
+    Registry& reg = registry();
+    reg.exporterStop = false;
+    reg.exporter = std::thread([path, intervalMs]() {
+        Registry& r = registry();
+        bool csv = endsWith(path, ".csv");
+        std::unique_lock<std::mutex> lock(r.exporterMutex);
+        while (!r.exporterStop) {
+            r.exporterWake.wait_for(lock, std::chrono::milliseconds(intervalMs));
+            if (csv) {
+                exportCsv(path);
+            } else {
+                exportJson(path);
+            }
+        }
+    });
+}
+
+void Instrumentation::stopPeriodicExport() {
+    Registry& reg = registry();
+    if (!reg.exporter.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(reg.exporterMutex);
+        reg.exporterStop = true;
+    }
+    reg.exporterWake.notify_all();
+    reg.exporter.join();
+}
+
+#endif // RADMON_INSTRUMENTATION
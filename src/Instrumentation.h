@@ -0,0 +1,104 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+// Instrumentación de rutas calientes. Se activa compilando con
+// -DRADMON_INSTRUMENTATION; sin esa bandera las macros no generan código.
+
+#define RADMON_CONCAT_IMPL(a, b) a##b
+#define RADMON_CONCAT(a, b) RADMON_CONCAT_IMPL(a, b)
+
+#ifdef RADMON_INSTRUMENTATION
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Histograma log-lineal estilo HDR: 16 sub-cubetas por potencia de dos
+// (error relativo < 6.25%) hasta ~18 minutos en nanosegundos.
+// Un único hilo escribe cada histograma; los lectores usan cargas relajadas.
+class LatencyHistogram {
+public:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int MAX_MAGNITUDE = 40;
+    static const int BUCKET_COUNT = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 2) * SUB_BUCKETS;
+
+    LatencyHistogram();
+
+    void record(uint64_t nanoseconds);
+    uint64_t getCount() const;
+    uint64_t getBucket(int index) const;
+    uint64_t getSum() const;
+    uint64_t getMax() const;
+
+    static int bucketIndex(uint64_t nanoseconds);
+    static uint64_t bucketLowerBound(int index);
+
+private:
+    std::atomic<uint64_t> buckets[BUCKET_COUNT];
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> max;
+};
+
+struct ProbeSummary {
+    std::string name;
+    uint64_t count;
+    double meanMicroseconds;
+    double p50Microseconds;
+    double p90Microseconds;
+    double p99Microseconds;
+    double maxMicroseconds;
+};
+
+class Instrumentation {
+public:
+    static const int MAX_PROBES = 32;
+
+    // Registro de sondas (una vez por punto de medida)
+    static int registerProbe(const char* name);
+    static void record(int probeId, uint64_t nanoseconds);
+
+    // Agregado de todos los hilos
+    static std::vector<ProbeSummary> snapshot();
+
+    // Exportación
+    static bool exportJson(const std::string& path);
+    static bool exportCsv(const std::string& path);
+    static void startPeriodicExport(const std::string& path, int intervalMs);
+    static void stopPeriodicExport();
+};
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int probeId)
+        : probe(probeId), start(std::chrono::steady_clock::now()) {
+    }
+
+    ~ScopedTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Instrumentation::record(probe,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    int probe;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define RADMON_SCOPED_TIMER(name) \
+    static const int RADMON_CONCAT(radmonProbe_, __LINE__) = Instrumentation::registerProbe(name); \
+    ScopedTimer RADMON_CONCAT(radmonTimer_, __LINE__)(RADMON_CONCAT(radmonProbe_, __LINE__))
+
+#else
+
+#define RADMON_SCOPED_TIMER(name) ((void)0)
+
+#endif // RADMON_INSTRUMENTATION
+
+#endif // INSTRUMENTATION_H
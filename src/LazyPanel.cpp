@@ -0,0 +1,38 @@
+#include "LazyPanel.h"
+#include "StartupProfiler.h"
+#include <QVBoxLayout>
+
+LazyPanel::LazyPanel(Factory factory, QWidget* parent)
+    : QWidget(parent), factory(std::move(factory)), content(nullptr) {
+    layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+}
+
+bool LazyPanel::isBuilt() {
+    return content != nullptr;
+}
+
+QWidget* LazyPanel::getContent() {
+    return content;
+}
+
+QWidget* LazyPanel::ensureBuilt() {
+    if (content || !factory) return content;
+
+    content = factory();
+    factory = nullptr;  // Libera lo que capture la fábrica
+    if (!content) return nullptr;
+
+    layout->addWidget(content);
+    if (!StartupProfiler::instance().hasFirstFrame()) {
+        QString name = content->objectName().isEmpty() ? content->metaObject()->className() : content->objectName();
+        StartupProfiler::instance().markPhase("Panel " + name);
+    }
+    emit contentBuilt(content);
+    return content;
+}
+
+void LazyPanel::showEvent(QShowEvent* event) {
+    ensureBuilt();
+    QWidget::showEvent(event);
+}
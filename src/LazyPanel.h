@@ -0,0 +1,39 @@
+#ifndef LAZYPANEL_H
+#define LAZYPANEL_H
+
+#include <QWidget>
+#include <functional>
+
+class QVBoxLayout;
+
+// Contenedor que construye su contenido la primera vez que se muestra.
+// Pensado para las pestañas y paneles de la ventana principal: un
+// QTabWidget solo muestra la página activa, así que las demás no se
+// crean hasta que el usuario las abre.
+class LazyPanel : public QWidget {
+    Q_OBJECT
+
+public:
+    typedef std::function<QWidget*()> Factory;
+
+    explicit LazyPanel(Factory factory, QWidget* parent = nullptr);
+
+    bool isBuilt();
+    QWidget* getContent();
+
+    // Fuerza la construcción (p. ej. para precargar en segundo plano tras el arranque)
+    QWidget* ensureBuilt();
+
+signals:
+    void contentBuilt(QWidget* content);
+
+protected:
+    void showEvent(QShowEvent* event) override;
+
+private:
+    Factory factory;
+    QWidget* content;
+    QVBoxLayout* layout;
+};
+
+#endif // LAZYPANEL_H
@@ -0,0 +1,106 @@
+#include "PrecisionPolicy.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    // Umbrales y escalones del indicador con sus vecinos inmediatos en
+    // double, en float y en nSv, más valores especiales
+    std::vector<double> buildBoundaryValues() {
+        std::vector<double> values = { 0.0, -0.0, -1e-12, -0.25, 1e-300, 1e-12, 1e9, 1e15, 1e300,
+                                       std::numeric_limits<double>::infinity(),
+                                       std::numeric_limits<double>::quiet_NaN() };
+
+        std::vector<double> boundaries(RadiationCalculator::DANGER_THRESHOLDS, RadiationCalculator::DANGER_THRESHOLDS + 4);
+        for (int k = 1; k <= 10; ++k) {
+            boundaries.push_back(RadiationCalculator::DANGER_THRESHOLDS[3] * std::pow(10.0, k / 5.0));
+        }
+
+        for (double boundary : boundaries) {
+            double down = boundary;
+            double up = boundary;
+            values.push_back(boundary);
+            for (int step = 0; step < 8; ++step) {
+                down = std::nextafter(down, 0.0);
+                up = std::nextafter(up, std::numeric_limits<double>::infinity());
+                values.push_back(down);
+                values.push_back(up);
+            }
+
+            float boundaryFloat = static_cast<float>(boundary);
+            values.push_back(std::nextafter(boundaryFloat, 0.0f));
+            values.push_back(std::nextafter(boundaryFloat, std::numeric_limits<float>::infinity()));
+            values.push_back((static_cast<double>(boundaryFloat) + std::nextafter(boundaryFloat, 0.0f)) * 0.5);
+
+            for (double relative : { 1e-15, 1e-12, 1e-9, 1e-7, 1e-6, 1e-4 }) {
+                values.push_back(boundary * (1.0 - relative));
+                values.push_back(boundary * (1.0 + relative));
+            }
+            values.push_back(boundary - 0.0005);   // Medio nSv por debajo
+            values.push_back(boundary - 0.001);    // Un nSv por debajo
+        }
+
+        // Barrido logarítmico denso para el indicador
+        for (int i = 0; i <= 20000; ++i) {
+            values.push_back(std::pow(10.0, -3.0 + 12.0 * i / 20000.0));
+        }
+        return values;
+    }
+
+    // Cadena de comparaciones original de getDangerLevel, independiente de
+    // los núcleos que se verifican
+    DangerLevel referenceLevel(double microSieverts) {
+        if (microSieverts < 0.5) {
+            return DangerLevel::SAFE;
+        } else if (microSieverts < 2.0) {
+            return DangerLevel::CAUTION;
+        } else if (microSieverts < 100.0) {
+            return DangerLevel::DANGEROUS;
+        } else if (microSieverts < 1000.0) {
+            return DangerLevel::EXTREME;
+        } else {
+            return DangerLevel::LETHAL;
+        }
+    }
+}
+
+PrecisionAgreementReport verifyPrecisionAgreement() {
+    std::vector<double> values = buildBoundaryValues();
+    size_t count = values.size();
+
+    std::vector<float> floats(count);
+    std::vector<int64_t> fixed(count);
+    convertFromMicroSieverts<FloatPrecision>(values.data(), count, floats.data());
+    convertFromMicroSieverts<FixedPointPrecision>(values.data(), count, fixed.data());
+
+    std::vector<DangerLevel> doubleLevels(count);
+    std::vector<DangerLevel> floatLevels(count);
+    std::vector<DangerLevel> fixedLevels(count);
+    classifyKernel<DoublePrecision>(values.data(), count, doubleLevels.data());
+    classifyKernel<FloatPrecision>(floats.data(), count, floatLevels.data());
+    classifyKernel<FixedPointPrecision>(fixed.data(), count, fixedLevels.data());
+
+    std::vector<int> doubleGauge(count);
+    std::vector<int> floatGauge(count);
+    std::vector<int> fixedGauge(count);
+    gaugeKernel<DoublePrecision>(values.data(), count, doubleGauge.data());
+    gaugeKernel<FloatPrecision>(floats.data(), count, floatGauge.data());
+    gaugeKernel<FixedPointPrecision>(fixed.data(), count, fixedGauge.data());
+
+    RadiationCalculator calculator;
+    PrecisionAgreementReport report = { count, 0, 0, 0, 0, 0, 0 };
+    for (size_t i = 0; i < count; ++i) {
+        DangerLevel expected = referenceLevel(values[i]);
+        if (doubleLevels[i] != expected) ++report.doubleLevelMismatches;
+        if (floatLevels[i] != expected) ++report.floatLevelMismatches;
+        if (fixedLevels[i] != expected) ++report.fixedLevelMismatches;
+
+        // El indicador no está definido para NaN ni para infinitos
+        if (!std::isfinite(values[i]) || values[i] > 1e15) continue;
+        int expectedGauge = calculator.getDangerPercentage(values[i]);
+        report.maxDoubleGaugeDelta = std::max(report.maxDoubleGaugeDelta, std::abs(doubleGauge[i] - expectedGauge));
+        report.maxFloatGaugeDelta = std::max(report.maxFloatGaugeDelta, std::abs(floatGauge[i] - expectedGauge));
+        report.maxFixedGaugeDelta = std::max(report.maxFixedGaugeDelta, std::abs(fixedGauge[i] - expectedGauge));
+    }
+    return report;
+}
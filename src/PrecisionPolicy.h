@@ -0,0 +1,171 @@
+#ifndef PRECISIONPOLICY_H
+#define PRECISIONPOLICY_H
+
+#include "RadiationCalculator.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Políticas de precisión para los núcleos de clasificación y del
+// indicador de peligro. Cada política define el tipo de valor, la
+// conversión desde μSv/h en double y cómo se escala un tramo del
+// indicador. Los umbrales (0.5, 2, 100 y 1000 μSv/h) son exactos en las
+// tres representaciones, y las conversiones redondean hacia abajo, así
+// que "v >= umbral" da el mismo resultado que en double.
+
+// Referencia: double sin conversión
+struct DoublePrecision {
+    typedef double Value;
+
+    static const char* name() { return "double"; }
+    static Value fromMicroSieverts(double microSieverts) { return microSieverts; }
+    static double toMicroSieverts(Value value) { return value; }
+    static Value nextUp(Value value) { return std::nextafter(value, std::numeric_limits<Value>::infinity()); }
+
+    static int scaleSegment(Value value, Value low, Value width, int span) {
+        return static_cast<int>((value - low) / width * span);
+    }
+};
+
+// float32: el doble de elementos por registro SIMD y la mitad de memoria.
+// La conversión toma el mayor float <= v; con redondeo al más cercano un
+// valor justo por debajo de un umbral podría subir hasta él
+struct FloatPrecision {
+    typedef float Value;
+
+    static const char* name() { return "float"; }
+    static Value fromMicroSieverts(double microSieverts) {
+        float rounded = static_cast<float>(microSieverts);
+        return static_cast<double>(rounded) > microSieverts
+            ? std::nextafter(rounded, -std::numeric_limits<float>::infinity())
+            : rounded;
+    }
+    static double toMicroSieverts(Value value) { return value; }
+    static Value nextUp(Value value) { return std::nextafter(value, std::numeric_limits<Value>::infinity()); }
+
+    static int scaleSegment(Value value, Value low, Value width, int span) {
+        return static_cast<int>((value - low) / width * static_cast<float>(span));
+    }
+};
+
+// Punto fijo en nanosieverts/h (enteros de 64 bits) para contabilidad
+// exacta. La conversión es floor(v · 1000) corregido con fma: si el
+// producto se redondeó hacia arriba hasta un entero, se resta uno
+struct FixedPointPrecision {
+    typedef int64_t Value;
+
+    static const char* name() { return "fixed_nsv"; }
+    static Value fromMicroSieverts(double microSieverts) {
+        if (std::isnan(microSieverts) || microSieverts >= 9.2e15) return std::numeric_limits<Value>::max();
+        if (microSieverts <= -9.2e15) return std::numeric_limits<Value>::min();
+
+        double product = microSieverts * 1000.0;
+        double residual = std::fma(microSieverts, 1000.0, -product);
+        double floored = std::floor(product);
+        if (floored == product && residual < 0.0) {
+            floored -= 1.0;
+        }
+        return static_cast<Value>(floored);
+    }
+    static double toMicroSieverts(Value value) { return value / 1000.0; }
+    static Value nextUp(Value value) { return value + 1; }
+
+    // División entera: trunca hacia cero igual que static_cast<int> en double
+    static int scaleSegment(Value value, Value low, Value width, int span) {
+        return static_cast<int>((value - low) * span / width);
+    }
+};
+
+// Nivel de peligro = número de umbrales alcanzados. Se usa !(v < t) en
+// lugar de v >= t para conservar el comportamiento de getDangerLevel con
+// NaN (LETAL)
+template <typename Policy>
+inline DangerLevel classifyValue(typename Policy::Value value) {
+    typedef typename Policy::Value Value;
+    const Value t0 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[0]);
+    const Value t1 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[1]);
+    const Value t2 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[2]);
+    const Value t3 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[3]);
+    int level = !(value < t0) + !(value < t1) + !(value < t2) + !(value < t3);
+    return static_cast<DangerLevel>(level);
+}
+
+template <typename Policy>
+void classifyKernel(const typename Policy::Value* values, size_t count, DangerLevel* outLevels) {
+    typedef typename Policy::Value Value;
+    const Value t0 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[0]);
+    const Value t1 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[1]);
+    const Value t2 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[2]);
+    const Value t3 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[3]);
+
+    for (size_t i = 0; i < count; ++i) {
+        Value v = values[i];
+        int level = !(v < t0) + !(v < t1) + !(v < t2) + !(v < t3);
+        outLevels[i] = static_cast<DangerLevel>(level);
+    }
+}
+
+// Indicador 0-100 por tramos, como getDangerPercentage. El tramo
+// logarítmico por encima de 1000 μSv/h (90 + 5·log10(v/1000)) se calcula
+// contando los escalones 1000·10^(k/5) superados, sin log10 en el bucle
+template <typename Policy>
+void gaugeKernel(const typename Policy::Value* values, size_t count, int* outPercentages) {
+    typedef typename Policy::Value Value;
+    const Value zero = Policy::fromMicroSieverts(0.0);
+    const Value t0 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[0]);
+    const Value t1 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[1]);
+    const Value t2 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[2]);
+    const Value t3 = Policy::fromMicroSieverts(RadiationCalculator::DANGER_THRESHOLDS[3]);
+
+    // Escalón k: el menor valor representable en que el indicador llega a 90 + k
+    Value steps[10];
+    for (int k = 0; k < 10; ++k) {
+        double step = RadiationCalculator::DANGER_THRESHOLDS[3] * std::pow(10.0, (k + 1) / 5.0);
+        Value converted = Policy::fromMicroSieverts(step);
+        steps[k] = Policy::toMicroSieverts(converted) < step ? Policy::nextUp(converted) : converted;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        Value v = values[i];
+        int logSegment = 90;
+        for (int k = 0; k < 10; ++k) {
+            logSegment += !(v < steps[k]);
+        }
+
+        // Todos los tramos se evalúan para no ramificar; la entrada de los
+        // lineales se satura a [-1000, 1000] μSv/h para evitar desbordes
+        // en punto fijo (los negativos por debajo de -1000 quedan saturados)
+        Value linear = v < t3 ? v : t3;
+        linear = linear > -t3 ? linear : -t3;
+        int percent = logSegment;
+        percent = v <= t3 ? 70 + Policy::scaleSegment(linear, t2, t3 - t2, 20) : percent;
+        percent = v <= t2 ? 40 + Policy::scaleSegment(linear, t1, t2 - t1, 30) : percent;
+        percent = v <= t1 ? 20 + Policy::scaleSegment(linear, t0, t1 - t0, 20) : percent;
+        percent = v <= t0 ? Policy::scaleSegment(linear, zero, t0, 20) : percent;
+        outPercentages[i] = percent;
+    }
+}
+
+template <typename Policy>
+void convertFromMicroSieverts(const double* microSieverts, size_t count, typename Policy::Value* outValues) {
+    for (size_t i = 0; i < count; ++i) {
+        outValues[i] = Policy::fromMicroSieverts(microSieverts[i]);
+    }
+}
+
+// Coincidencia de cada precisión con la referencia double en valores
+// frontera (umbrales ± varios ulp, ceros, negativos, extremos y NaN)
+struct PrecisionAgreementReport {
+    size_t valuesChecked;
+    size_t doubleLevelMismatches;
+    size_t floatLevelMismatches;
+    size_t fixedLevelMismatches;
+    int maxDoubleGaugeDelta;     // Diferencia máxima del indicador, en puntos
+    int maxFloatGaugeDelta;
+    int maxFixedGaugeDelta;
+};
+
+PrecisionAgreementReport verifyPrecisionAgreement();
+
+#endif // PRECISIONPOLICY_H
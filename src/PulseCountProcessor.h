@@ -0,0 +1,75 @@
+#ifndef PULSECOUNTPROCESSOR_H
+#define PULSECOUNTPROCESSOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class DeadTimeModel {
+    NON_PARALYZABLE,   // n = m / (1 - m·τ)
+    PARALYZABLE        // m = n · e^(-n·τ)
+};
+
+enum class CountUnit {
+    COUNTS_PER_MINUTE,
+    COUNTS_PER_SECOND
+};
+
+struct DetectorProfile {
+    std::string detectorId;
+    double cpmPerMicroSievert;   // Factor de calibración: CPM por μSv/h
+    double deadTimeSeconds;      // Tiempo muerto τ del tubo
+    double backgroundCpm;        // Fondo propio del detector
+    DeadTimeModel deadTimeModel;
+};
+
+class PulseCountProcessor {
+public:
+    PulseCountProcessor();
+
+    // Perfiles de calibración por detector
+    int registerDetector(const DetectorProfile& profile);
+    int findDetector(const std::string& detectorId);
+    const DetectorProfile& getProfile(int detectorIndex);   // Perfil vacío si el índice no es válido
+    size_t getDetectorCount();
+    bool isValidDetector(int detectorIndex);
+
+    // Corrección de tiempo muerto (tasas en cuentas por segundo).
+    // Las funciones por detector devuelven NaN con un índice no válido
+    double correctDeadTime(double measuredCps, int detectorIndex);
+
+    // Conversión de cuentas a μSv/h, lista para getDangerLevel
+    double countsToMicroSieverts(double counts, double intervalSeconds, int detectorIndex);
+    double rateToMicroSieverts(double rate, CountUnit unit, int detectorIndex);
+
+    // Procesamiento por lotes: un intervalo de conteo por elemento.
+    // Un índice de detector no registrado da NaN en su posición
+    void processBatch(const uint32_t* detectorIndices, const double* counts,
+                      const double* intervalSeconds, size_t count, double* outMicroSieverts);
+    std::vector<double> processBatch(const std::vector<uint32_t>& detectorIndices,
+                                     const std::vector<double>& counts,
+                                     const std::vector<double>& intervalSeconds);
+
+private:
+    std::vector<DetectorProfile> profiles;
+
+    // Parámetros en formato SoA para los lotes
+    std::vector<double> cpsPerMicroSievert;
+    std::vector<double> microSievertsPerCps;   // Inverso, 0 si la calibración no es válida
+    std::vector<double> deadTimes;
+    std::vector<double> inverseDeadTimes;      // Tasa real de saturación paralizable
+    std::vector<double> backgroundCps;
+    std::vector<double> paralyzableMask;
+
+    // Búferes reutilizados entre lotes para evitar asignaciones
+    std::vector<double> scratchRate;
+    std::vector<double> scratchTau;
+    std::vector<double> scratchInverseTau;
+    std::vector<double> scratchParalyzable;
+
+    static double correctNonParalyzable(double measuredCps, double tau);
+    static double correctParalyzable(double measuredCps, double tau);
+};
+
+#endif // PULSECOUNTPROCESSOR_H
@@ -0,0 +1,150 @@
+#include "QueryProtocol.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+    // Busca "clave": en una línea JSON plana y devuelve el inicio del valor
+    const char* findJsonValue(const char* line, size_t length, const char* key) {
+        size_t keyLength = std::strlen(key);
+        const char* end = line + length;
+        for (const char* p = line; p + keyLength + 2 < end; ++p) {
+            if (*p == '"' && std::strncmp(p + 1, key, keyLength) == 0 && p[keyLength + 1] == '"') {
+                const char* value = p + keyLength + 2;
+                while (value < end && (*value == ' ' || *value == ':')) ++value;
+                return value < end ? value : nullptr;
+            }
+        }
+        return nullptr;
+    }
+}
+
+void QueryProtocol::encodeRequest(const QueryRequest& request, std::string& out) {
+    putU32(out, static_cast<uint32_t>(REQUEST_PAYLOAD_SIZE));
+    putU8(out, static_cast<uint8_t>(request.operation));
+    putU32(out, request.requestId);
+    putF64(out, request.microSieverts);
+    putF64(out, request.exposureHours);
+}
+
+bool QueryProtocol::decodeRequest(const char* payload, size_t length, QueryRequest& request) {
+    request.operation = length >= 1 ? static_cast<QueryOperation>(static_cast<uint8_t>(payload[0])) : static_cast<QueryOperation>(0);
+    request.requestId = length >= 5 ? readU32(payload + 1) : 0;
+    request.microSieverts = 0.0;
+    request.exposureHours = 1.0;
+    if (length < REQUEST_PAYLOAD_SIZE) return false;
+
+    request.microSieverts = readF64(payload + 5);
+    request.exposureHours = readF64(payload + 13);
+    return isValidRequest(request);
+}
+
+size_t QueryProtocol::beginResponse(std::string& out, QueryOperation operation, uint32_t requestId, QueryStatus status) {
+    size_t frameStart = out.size();
+    putU32(out, 0);  // Longitud provisional, se corrige en endResponse
+    putU8(out, static_cast<uint8_t>(operation));
+    putU32(out, requestId);
+    putU8(out, static_cast<uint8_t>(status));
+    return frameStart;
+}
+
+void QueryProtocol::endResponse(std::string& out, size_t frameStart) {
+    uint32_t length = static_cast<uint32_t>(out.size() - frameStart - FRAME_HEADER_SIZE);
+    for (int i = 0; i < 4; ++i) {
+        out[frameStart + i] = static_cast<char>((length >> (8 * i)) & 0xFF);
+    }
+}
+
+bool QueryProtocol::parseJsonRequest(const char* line, size_t length, QueryRequest& request) {
+    // La línea se copia para que strtod/strtoul no lean más allá de ella
+    std::string text(line, length);
+    const char* begin = text.c_str();
+    const char* op = findJsonValue(begin, length, "op");
+    const char* value = findJsonValue(begin, length, "value");
+    const char* id = findJsonValue(begin, length, "id");
+    const char* hours = findJsonValue(begin, length, "hours");
+
+    request.operation = static_cast<QueryOperation>(0);
+    if (op && *op == '"') {
+        ++op;
+        if (std::strncmp(op, "level\"", 6) == 0) request.operation = QueryOperation::DANGER_LEVEL;
+        else if (std::strncmp(op, "safe_exposure\"", 14) == 0) request.operation = QueryOperation::SAFE_EXPOSURE;
+        else if (std::strncmp(op, "analyze\"", 8) == 0) request.operation = QueryOperation::ANALYZE;
+        else if (std::strncmp(op, "report\"", 7) == 0) request.operation = QueryOperation::REPORT;
+    }
+    request.requestId = id ? static_cast<uint32_t>(std::strtoul(id, nullptr, 10)) : 0;
+    request.microSieverts = 0.0;
+    request.exposureHours = 1.0;
+    if (!op || !value) return false;
+
+    // Un valor que strtod no consume (p. ej. "x") no es un número
+    char* end = nullptr;
+    request.microSieverts = std::strtod(value, &end);
+    if (end == value) return false;
+    if (hours) {
+        request.exposureHours = std::strtod(hours, &end);
+        if (end == hours) return false;
+    }
+    return isValidRequest(request);
+}
+
+bool QueryProtocol::isValidRequest(const QueryRequest& request) {
+    return std::isfinite(request.microSieverts) && request.microSieverts >= 0.0 &&
+           std::isfinite(request.exposureHours) && request.exposureHours >= 0.0;
+}
+
+const char* QueryProtocol::operationName(QueryOperation operation) {
+    switch (operation) {
+        case QueryOperation::DANGER_LEVEL: return "level";
+        case QueryOperation::SAFE_EXPOSURE: return "safe_exposure";
+        case QueryOperation::ANALYZE: return "analyze";
+        case QueryOperation::REPORT: return "report";
+        default: return "unknown";
+    }
+}
+
+void QueryProtocol::putU8(std::string& out, uint8_t value) {
+    out.push_back(static_cast<char>(value));
+}
+
+void QueryProtocol::putU16(std::string& out, uint16_t value) {
+    out.push_back(static_cast<char>(value & 0xFF));
+    out.push_back(static_cast<char>(value >> 8));
+}
+
+void QueryProtocol::putU32(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void QueryProtocol::putF64(std::string& out, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+uint32_t QueryProtocol::readU32(const char* data) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+uint16_t QueryProtocol::readU16(const char* data) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+double QueryProtocol::readF64(const char* data) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+        bits |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
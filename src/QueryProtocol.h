@@ -0,0 +1,80 @@
+#ifndef QUERYPROTOCOL_H
+#define QUERYPROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Protocolo del servicio de consultas sin interfaz gráfica.
+//
+// Modo binario: cada trama es u32 longitud (little-endian) + carga útil.
+//   Petición:  u8 operación | u32 id | f64 μSv/h | f64 horas de exposición
+//   Respuesta: u8 operación | u32 id | u8 estado | cuerpo según operación
+//     DANGER_LEVEL:  u8 nivel | u8 porcentaje
+//     SAFE_EXPOSURE: f64 horas
+//     ANALYZE:       u8 nivel | f64 superv. sin tratamiento | f64 con tratamiento
+//                    | u16 long. + clasificación médica | u16 long. + protocolo
+//     REPORT:        u32 long. + informe
+//
+// Modo JSON: una petición por línea, p. ej.
+//   {"op":"level","id":1,"value":3.5,"hours":1}
+// El servidor detecta el modo por el primer byte de la conexión ('{').
+//
+// Toda petición enmarcada recibe respuesta: si no se puede decodificar o
+// sus valores no son finitos y no negativos, el estado es BAD_REQUEST
+// con la operación y el id que se hayan podido leer (0 si no).
+
+enum class QueryOperation : uint8_t {
+    DANGER_LEVEL = 1,
+    SAFE_EXPOSURE = 2,
+    ANALYZE = 3,
+    REPORT = 4
+};
+
+enum class QueryStatus : uint8_t {
+    OK = 0,
+    BAD_REQUEST = 1,
+    UNKNOWN_OPERATION = 2
+};
+
+struct QueryRequest {
+    QueryOperation operation;
+    uint32_t requestId;
+    double microSieverts;
+    double exposureHours;
+};
+
+class QueryProtocol {
+public:
+    static const size_t FRAME_HEADER_SIZE = 4;
+    static const size_t REQUEST_PAYLOAD_SIZE = 21;
+    static const size_t MAX_FRAME_SIZE = 1 << 20;
+    static const size_t MAX_JSON_LINE = 64 * 1024;
+
+    // Las funciones de decodificación rellenan operación e id aunque
+    // fallen, para poder responder BAD_REQUEST a la petición
+
+    // Tramas binarias
+    static void encodeRequest(const QueryRequest& request, std::string& out);
+    static bool decodeRequest(const char* payload, size_t length, QueryRequest& request);
+
+    // Escritura de respuestas binarias (el llamador rellena el cuerpo)
+    static size_t beginResponse(std::string& out, QueryOperation operation, uint32_t requestId, QueryStatus status);
+    static void endResponse(std::string& out, size_t frameStart);
+
+    // Modo JSON
+    static bool parseJsonRequest(const char* line, size_t length, QueryRequest& request);
+    static bool isValidRequest(const QueryRequest& request);   // Valores finitos y no negativos
+    static const char* operationName(QueryOperation operation);
+
+    // Primitivas little-endian
+    static void putU8(std::string& out, uint8_t value);
+    static void putU16(std::string& out, uint16_t value);
+    static void putU32(std::string& out, uint32_t value);
+    static void putF64(std::string& out, double value);
+    static uint32_t readU32(const char* data);
+    static uint16_t readU16(const char* data);
+    static double readF64(const char* data);
+};
+
+#endif // QUERYPROTOCOL_H
@@ -0,0 +1,460 @@
+#include "QueryServer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    const size_t READ_CHUNK = 64 * 1024;
+    const size_t MAX_READ_PER_WAKE = 1 << 20;        // El resto llega en la siguiente vuelta
+    const size_t OUTPUT_HIGH_WATER = 4 << 20;        // Se deja de leer por encima de esto
+    const size_t OUTPUT_LOW_WATER = 1 << 20;         // y se reanuda al bajar de esto
+    const char* LEVEL_NAMES[] = { "SAFE", "CAUTION", "DANGEROUS", "EXTREME", "LETHAL" };
+
+    bool setNonBlocking(int fd) {
+        int flags = fcntl(fd, F_GETFL, 0);
+        return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    void appendJsonString(std::string& out, const std::string& text) {
+        out.push_back('"');
+        for (char c : text) {
+            switch (c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default: out.push_back(c); break;
+            }
+        }
+        out.push_back('"');
+    }
+
+    void putShortString(std::string& out, const std::string& text) {
+        size_t length = std::min<size_t>(text.size(), 0xFFFF);
+        QueryProtocol::putU16(out, static_cast<uint16_t>(length));
+        out.append(text, 0, length);
+    }
+
+    const char* levelName(DangerLevel level) {
+        int index = static_cast<int>(level);
+        return (index >= 0 && index < 5) ? LEVEL_NAMES[index] : LEVEL_NAMES[0];
+    }
+}
+
+QueryServer::QueryServer()
+    : listenFd(-1), epollFd(-1), wakeFd(-1), running(false), requestsServed(0) {
+}
+
+QueryServer::~QueryServer() {
+    for (auto& entry : connections) {
+        ::close(entry.first);
+    }
+    if (listenFd >= 0) ::close(listenFd);
+    if (epollFd >= 0) ::close(epollFd);
+    if (wakeFd >= 0) ::close(wakeFd);
+    if (!config.unixSocketPath.empty()) {
+        ::unlink(config.unixSocketPath.c_str());
+    }
+}
+
+bool QueryServer::start(const QueryServerConfig& serverConfig) {
+    config = serverConfig;
+
+    if (!config.unixSocketPath.empty()) {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (config.unixSocketPath.size() >= sizeof(address.sun_path)) {
+            return fail("Ruta de socket demasiado larga");
+        }
+        std::strncpy(address.sun_path, config.unixSocketPath.c_str(), sizeof(address.sun_path) - 1);
+        ::unlink(config.unixSocketPath.c_str());
+
+        listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0 || ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            return fail("No se pudo enlazar el socket Unix");
+        }
+    } else {
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_port = htons(config.tcpPort);
+        if (::inet_pton(AF_INET, config.tcpAddress.c_str(), &address.sin_addr) != 1) {
+            return fail("Dirección TCP inválida");
+        }
+
+        listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        if (listenFd >= 0) {
+            ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        }
+        if (listenFd < 0 || ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+            return fail("No se pudo enlazar el puerto TCP");
+        }
+    }
+
+    if (::listen(listenFd, SOMAXCONN) < 0 || !setNonBlocking(listenFd)) {
+        return fail("No se pudo escuchar en el socket");
+    }
+
+    epollFd = ::epoll_create1(0);
+    wakeFd = ::eventfd(0, EFD_NONBLOCK);
+    if (epollFd < 0 || wakeFd < 0) {
+        return fail("No se pudo crear epoll/eventfd");
+    }
+
+    epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    event.data.fd = wakeFd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+    return true;
+}
+
+void QueryServer::run() {
+    std::vector<epoll_event> events(std::max(1, config.maxEventsPerWait));
+    std::vector<int> closing;
+    running = epollFd >= 0;
+
+    while (running) {
+        int ready = ::epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            fail("epoll_wait falló");
+            break;
+        }
+
+        // Fase 1: lectura y decodificación de todas las conexiones listas
+        for (int i = 0; i < ready; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == listenFd) {
+                acceptConnections();
+                continue;
+            }
+            if (fd == wakeFd) {
+                uint64_t value;
+                while (::read(wakeFd, &value, sizeof(value)) > 0) {}
+                running = false;
+                continue;
+            }
+
+            auto it = connections.find(fd);
+            if (it == connections.end()) continue;
+            Connection& connection = it->second;
+
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                readConnection(connection);
+                if (connection.closing) {
+                    closing.push_back(fd);
+                    continue;
+                }
+            }
+            if (events[i].events & EPOLLOUT) {
+                flushConnection(connection);
+            }
+        }
+
+        // Fase 2: resolución por lotes y escritura
+        processBatch();
+
+        // Los cierres se aplazan para que ningún fd se reutilice a mitad de lote
+        for (int fd : closing) {
+            closeConnection(fd);
+        }
+        closing.clear();
+    }
+}
+
+void QueryServer::stop() {
+    uint64_t one = 1;
+    if (wakeFd >= 0) {
+        ssize_t written = ::write(wakeFd, &one, sizeof(one));
+        (void)written;
+    }
+}
+
+const std::string& QueryServer::getLastError() {
+    return lastError;
+}
+
+uint64_t QueryServer::getRequestsServed() {
+    return requestsServed;
+}
+
+bool QueryServer::fail(const std::string& message) {
+    lastError = message + ": " + std::strerror(errno);
+    return false;
+}
+
+void QueryServer::acceptConnections() {
+    while (true) {
+        int fd = ::accept(listenFd, nullptr, nullptr);
+        if (fd < 0) break;
+
+        setNonBlocking(fd);
+        if (config.unixSocketPath.empty()) {
+            int noDelay = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        }
+
+        epoll_event event;
+        std::memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            ::close(fd);
+            continue;
+        }
+
+        connections[fd] = Connection{ fd, ConnectionMode::UNKNOWN, std::string(), std::string(), false, false, false };
+    }
+}
+
+void QueryServer::readConnection(Connection& connection) {
+    char buffer[READ_CHUNK];
+    size_t total = 0;
+    while (total < MAX_READ_PER_WAKE) {
+        ssize_t received = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+        if (received > 0) {
+            connection.input.append(buffer, static_cast<size_t>(received));
+            total += static_cast<size_t>(received);
+            continue;
+        }
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        // Cierre del par o error: se procesa lo ya recibido y se marca para cerrar
+        connection.closing = true;
+        break;
+    }
+
+    parseFrames(connection);
+}
+
+void QueryServer::parseFrames(Connection& connection) {
+    std::string& input = connection.input;
+    if (input.empty()) return;
+
+    if (connection.mode == ConnectionMode::UNKNOWN) {
+        connection.mode = input[0] == '{' ? ConnectionMode::JSON : ConnectionMode::BINARY;
+    }
+
+    int fd = connection.fd;
+    size_t offset = 0;
+
+    if (connection.mode == ConnectionMode::BINARY) {
+        while (input.size() - offset >= QueryProtocol::FRAME_HEADER_SIZE) {
+            uint32_t length = QueryProtocol::readU32(input.data() + offset);
+            if (length > QueryProtocol::MAX_FRAME_SIZE) {
+                connection.closing = true;  // Trama corrupta: se descarta la conexión
+                input.clear();
+                return;
+            }
+            if (input.size() - offset < QueryProtocol::FRAME_HEADER_SIZE + length) break;
+
+            PendingQuery query;
+            query.fd = fd;
+            query.json = false;
+            const char* payload = input.data() + offset + QueryProtocol::FRAME_HEADER_SIZE;
+            query.valid = QueryProtocol::decodeRequest(payload, length, query.request);
+            batch.push_back(query);
+            offset += QueryProtocol::FRAME_HEADER_SIZE + length;
+        }
+    } else {
+        while (offset < input.size()) {
+            size_t newline = input.find('\n', offset);
+            if (newline == std::string::npos) break;
+
+            PendingQuery query;
+            query.fd = fd;
+            query.json = true;
+            query.valid = QueryProtocol::parseJsonRequest(input.data() + offset, newline - offset, query.request);
+            batch.push_back(query);
+            offset = newline + 1;
+        }
+
+        // Una línea sin terminar más larga que el límite no es un cliente válido
+        if (input.size() - offset > QueryProtocol::MAX_JSON_LINE) {
+            connection.closing = true;
+            input.clear();
+            return;
+        }
+    }
+
+    input.erase(0, offset);
+}
+
+void QueryServer::processBatch() {
+    if (batch.empty()) return;
+
+    size_t count = batch.size();
+    batchValues.resize(count);
+    batchLevels.resize(count);
+    batchPercentages.resize(count);
+    batchHours.resize(count);
+
+    // Las peticiones inválidas entran al lote con 0.0 y se responden con BAD_REQUEST
+    for (size_t i = 0; i < count; ++i) {
+        batchValues[i] = batch[i].valid ? batch[i].request.microSieverts : 0.0;
+    }
+
+    // Clasificación y tiempo seguro en una sola pasada vectorizable para todo el lote
+    calculator.classifyBatch(batchValues.data(), count, batchLevels.data());
+    calculator.getDangerPercentageBatch(batchValues.data(), count, batchPercentages.data());
+    calculator.getSafeExposureTimeBatch(batchValues.data(), count, batchHours.data());
+
+    std::vector<int> touched;
+    for (size_t i = 0; i < count; ++i) {
+        const PendingQuery& query = batch[i];
+        auto it = connections.find(query.fd);
+        if (it == connections.end()) continue;
+
+        writeResponse(it->second, query, batchLevels[i], batchPercentages[i], batchHours[i]);
+        if (touched.empty() || touched.back() != query.fd) {
+            touched.push_back(query.fd);
+        }
+    }
+
+    requestsServed += count;
+    batch.clear();
+
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+    for (int fd : touched) {
+        auto it = connections.find(fd);
+        if (it != connections.end()) {
+            flushConnection(it->second);
+        }
+    }
+}
+
+void QueryServer::writeResponse(Connection& connection, const PendingQuery& query,
+                                DangerLevel level, int percentage, double hours) {
+    std::string& out = connection.output;
+    const QueryRequest& request = query.request;
+    QueryOperation op = request.operation;
+    bool known = op == QueryOperation::DANGER_LEVEL || op == QueryOperation::SAFE_EXPOSURE ||
+                 op == QueryOperation::ANALYZE || op == QueryOperation::REPORT;
+
+    if (query.json) {
+        char head[96];
+        std::snprintf(head, sizeof(head), "{\"id\":%u,\"op\":\"%s\",\"status\":\"%s\"",
+                      request.requestId, QueryProtocol::operationName(op),
+                      !query.valid ? "bad_request" : (known ? "ok" : "unknown_operation"));
+        out += head;
+        if (!query.valid) {
+            out += "}\n";
+            return;
+        }
+
+        char body[160];
+        if (op == QueryOperation::DANGER_LEVEL) {
+            std::snprintf(body, sizeof(body), ",\"level\":\"%s\",\"percent\":%d", levelName(level), percentage);
+            out += body;
+        } else if (op == QueryOperation::SAFE_EXPOSURE) {
+            std::snprintf(body, sizeof(body), ",\"hours\":%.6f", hours);
+            out += body;
+        } else if (op == QueryOperation::ANALYZE) {
+            HealthEffects effects = analyzer.analyzeEffects(request.microSieverts, request.exposureHours);
+            std::snprintf(body, sizeof(body), ",\"level\":\"%s\",\"survival_untreated\":%.1f,\"survival_treated\":%.1f",
+                          levelName(effects.dangerLevel), effects.survivalProbabilityWithoutTreatment,
+                          effects.survivalProbabilityWithTreatment);
+            out += body;
+            out += ",\"classification\":";
+            appendJsonString(out, effects.medicalClassification);
+            out += ",\"protocol\":";
+            appendJsonString(out, effects.emergencyProtocol);
+        } else if (op == QueryOperation::REPORT) {
+            HealthEffects effects = analyzer.analyzeEffects(request.microSieverts, request.exposureHours);
+            out += ",\"report\":";
+            appendJsonString(out, analyzer.formatHealthEffectsReport(effects));
+        }
+        out += "}\n";
+        return;
+    }
+
+    if (!query.valid) {
+        size_t frame = QueryProtocol::beginResponse(out, op, request.requestId, QueryStatus::BAD_REQUEST);
+        QueryProtocol::endResponse(out, frame);
+        return;
+    }
+
+    size_t frame = QueryProtocol::beginResponse(out, op, request.requestId,
+                                                known ? QueryStatus::OK : QueryStatus::UNKNOWN_OPERATION);
+    if (op == QueryOperation::DANGER_LEVEL) {
+        QueryProtocol::putU8(out, static_cast<uint8_t>(level));
+        QueryProtocol::putU8(out, static_cast<uint8_t>(percentage));
+    } else if (op == QueryOperation::SAFE_EXPOSURE) {
+        QueryProtocol::putF64(out, hours);
+    } else if (op == QueryOperation::ANALYZE) {
+        HealthEffects effects = analyzer.analyzeEffects(request.microSieverts, request.exposureHours);
+        QueryProtocol::putU8(out, static_cast<uint8_t>(effects.dangerLevel));
+        QueryProtocol::putF64(out, effects.survivalProbabilityWithoutTreatment);
+        QueryProtocol::putF64(out, effects.survivalProbabilityWithTreatment);
+        putShortString(out, effects.medicalClassification);
+        putShortString(out, effects.emergencyProtocol);
+    } else if (op == QueryOperation::REPORT) {
+        HealthEffects effects = analyzer.analyzeEffects(request.microSieverts, request.exposureHours);
+        std::string report = analyzer.formatHealthEffectsReport(effects);
+        QueryProtocol::putU32(out, static_cast<uint32_t>(report.size()));
+        out += report;
+    }
+    QueryProtocol::endResponse(out, frame);
+}
+
+void QueryServer::flushConnection(Connection& connection) {
+    size_t sent = 0;
+    while (sent < connection.output.size()) {
+        ssize_t written = ::send(connection.fd, connection.output.data() + sent,
+                                 connection.output.size() - sent, MSG_NOSIGNAL);
+        if (written > 0) {
+            sent += static_cast<size_t>(written);
+        } else if (written < 0 && errno == EINTR) {
+            continue;
+        } else {
+            break;
+        }
+    }
+    connection.output.erase(0, sent);
+    updateInterest(connection);
+}
+
+void QueryServer::updateInterest(Connection& connection) {
+    // Solo se vigila EPOLLOUT mientras quedan datos pendientes, y EPOLLIN
+    // se retira mientras el cliente no consume sus respuestas
+    size_t pending = connection.output.size();
+    bool wantsWrite = pending > 0;
+    bool readPaused = connection.readPaused ? pending > OUTPUT_LOW_WATER : pending > OUTPUT_HIGH_WATER;
+    if (wantsWrite == connection.wantsWrite && readPaused == connection.readPaused) return;
+
+    epoll_event event;
+    std::memset(&event, 0, sizeof(event));
+    event.events = (readPaused ? 0u : static_cast<uint32_t>(EPOLLIN)) | (wantsWrite ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+    event.data.fd = connection.fd;
+    ::epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.wantsWrite = wantsWrite;
+    connection.readPaused = readPaused;
+}
+
+void QueryServer::closeConnection(int fd) {
+    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections.erase(fd);
+}
@@ -0,0 +1,89 @@
+#ifndef QUERYSERVER_H
+#define QUERYSERVER_H
+
+#include "QueryProtocol.h"
+#include "RadiationCalculator.h"
+#include "HealthEffectAnalyzer.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct QueryServerConfig {
+    std::string unixSocketPath;         // Si no está vacío se usa socket de dominio Unix
+    std::string tcpAddress = "127.0.0.1";
+    uint16_t tcpPort = 7287;
+    int maxEventsPerWait = 256;
+};
+
+// Servicio de consultas sin Qt basado en epoll (Linux). Cada vuelta del
+// bucle lee todas las conexiones listas, agrupa las peticiones por
+// operación y las resuelve con las rutas por lotes del calculador.
+class QueryServer {
+public:
+    QueryServer();
+    ~QueryServer();
+
+    bool start(const QueryServerConfig& serverConfig);
+    void run();
+    void stop();   // Seguro desde otro hilo o un manejador de señales
+
+    const std::string& getLastError();
+    uint64_t getRequestsServed();
+
+private:
+    enum class ConnectionMode {
+        UNKNOWN,
+        BINARY,
+        JSON
+    };
+
+    struct Connection {
+        int fd;
+        ConnectionMode mode;
+        std::string input;
+        std::string output;
+        bool wantsWrite;
+        bool readPaused;   // Salida por encima del límite: no se lee hasta drenarla
+        bool closing;
+    };
+
+    struct PendingQuery {
+        int fd;
+        bool json;
+        bool valid;        // false: se responde BAD_REQUEST
+        QueryRequest request;
+    };
+
+    QueryServerConfig config;
+    int listenFd;
+    int epollFd;
+    int wakeFd;
+    bool running;
+    std::string lastError;
+    uint64_t requestsServed;
+
+    std::unordered_map<int, Connection> connections;
+    RadiationCalculator calculator;
+    HealthEffectAnalyzer analyzer;
+
+    // Búferes de lote reutilizados entre vueltas del bucle
+    std::vector<PendingQuery> batch;
+    std::vector<double> batchValues;
+    std::vector<DangerLevel> batchLevels;
+    std::vector<int> batchPercentages;
+    std::vector<double> batchHours;
+
+    bool fail(const std::string& message);
+    void acceptConnections();
+    void readConnection(Connection& connection);
+    void parseFrames(Connection& connection);
+    void processBatch();
+    void writeResponse(Connection& connection, const PendingQuery& query,
+                       DangerLevel level, int percentage, double hours);
+    void flushConnection(Connection& connection);
+    void updateInterest(Connection& connection);
+    void closeConnection(int fd);
+};
+
+#endif // QUERYSERVER_H
@@ -1,55 +1,23 @@
 #include "RadiationCalculator.h"
-#include <sstream>
-#include <iomanip>
+#include "Instrumentation.h"
+#include "PrecisionPolicy.h"
+#include "UnitRegistry.h"
 #include <cmath>
 
 RadiationCalculator::RadiationCalculator() {
 }
 
 double RadiationCalculator::convertToMicroSieverts(double value, RadiationUnit unit) {
-    switch (unit) {
-        case RadiationUnit::MICROSIEVERTS_PER_HOUR:
-            return value;
-        case RadiationUnit::MILLISIEVERTS_PER_HOUR:
-            return value * 1000.0;
-        case RadiationUnit::SIEVERTS_PER_HOUR:
-            return value * 1000000.0;
-        default:
-            return 0.0;
-    }
+    return UnitRegistry::getDefault().toMicroSieverts(value, UnitRegistry::getUnitId(unit));
 }
 
 std::string RadiationCalculator::formatWithUnit(double microSieverts, RadiationUnit targetUnit) {
-    std::ostringstream oss;
-    oss << std::fixed;
-    
-    switch (targetUnit) {
-        case RadiationUnit::MICROSIEVERTS_PER_HOUR:
-            oss << std::setprecision(1) << microSieverts << " μSv/h";
-            break;
-        case RadiationUnit::MILLISIEVERTS_PER_HOUR:
-            oss << std::setprecision(3) << microSievertsToMilliSieverts(microSieverts) << " mSv/h";
-            break;
-        case RadiationUnit::SIEVERTS_PER_HOUR:
-            oss << std::setprecision(6) << microSievertsToSieverts(microSieverts) << " Sv/h";
-            break;
-    }
-    
-    return oss.str();
+    RADMON_SCOPED_TIMER("formatWithUnit");
+    return UnitRegistry::getDefault().format(microSieverts, UnitRegistry::getUnitId(targetUnit));
 }
 
 DangerLevel RadiationCalculator::getDangerLevel(double microSieverts) {
-    if (microSieverts < 0.5) {
-        return DangerLevel::SAFE;
-    } else if (microSieverts < 2.0) {
-        return DangerLevel::CAUTION;
-    } else if (microSieverts < 100.0) {
-        return DangerLevel::DANGEROUS;
-    } else if (microSieverts < 1000.0) {
-        return DangerLevel::EXTREME;
-    } else {
-        return DangerLevel::LETHAL;
-    }
+    return classifyValue<DoublePrecision>(microSieverts);
 }
 
 std::string RadiationCalculator::getDangerDescription(DangerLevel level) {
@@ -101,9 +69,6 @@ int RadiationCalculator::getDangerPercentage(double microSieverts) {
 }
 
 double RadiationCalculator::getSafeExposureTime(double microSieverts) {
-    const double ANNUAL_LIMIT = 1000000.0; // 1 mSv/año en μSv
-    const double HOURS_PER_YEAR = 8760.0;
-    
     if (microSieverts <= 0.0) {
         return HOURS_PER_YEAR;
     }
@@ -118,36 +83,44 @@ double RadiationCalculator::getSafeExposureTime(double microSieverts) {
 }
 
 std::string RadiationCalculator::getAutoFormattedValue(double microSieverts) {
-    if (microSieverts >= 1000000.0) {
-        return formatWithUnit(microSieverts, RadiationUnit::SIEVERTS_PER_HOUR);
-    } else if (microSieverts >= 1000.0) {
-        return formatWithUnit(microSieverts, RadiationUnit::MILLISIEVERTS_PER_HOUR);
-    } else {
-        return formatWithUnit(microSieverts, RadiationUnit::MICROSIEVERTS_PER_HOUR);
-    }
+    RADMON_SCOPED_TIMER("getAutoFormattedValue");
+    return UnitRegistry::getDefault().formatAuto(microSieverts, "Sv/h");
 }
 
 bool RadiationCalculator::isValidRadiationLevel(double value, RadiationUnit unit) {
-    if (value < 0) return false;
-    
-    double microSieverts = convertToMicroSieverts(value, unit);
-    return microSieverts <= 1000000000.0; // Límite máximo práctico
+    return UnitRegistry::getDefault().isValidValue(value, UnitRegistry::getUnitId(unit));
 }
 
-double RadiationCalculator::microSievertsToMilliSieverts(double microSieverts) {
-    return microSieverts / 1000.0;
+void RadiationCalculator::classifyBatch(const double* microSieverts, size_t count, DangerLevel* outLevels) {
+    // El nivel es el número de umbrales superados: equivale a getDangerLevel
+    classifyKernel<DoublePrecision>(microSieverts, count, outLevels);
 }
 
-double RadiationCalculator::microSievertsToSieverts(double microSieverts) {
-    return microSieverts / 1000000.0;
+void RadiationCalculator::getDangerPercentageBatch(const double* microSieverts, size_t count, int* outPercentages) {
+    for (size_t i = 0; i < count; ++i) {
+        outPercentages[i] = getDangerPercentage(microSieverts[i]);
+    }
 }
 
-double RadiationCalculator::getDangerThreshold(DangerLevel level) {
-    switch (level) {
-        case DangerLevel::SAFE: return 0.5;
-        case DangerLevel::CAUTION: return 2.0;
-        case DangerLevel::DANGEROUS: return 100.0;
-        case DangerLevel::EXTREME: return 1000.0;
-        default: return 0.0;
+void RadiationCalculator::classifyBatch(const float* microSieverts, size_t count, DangerLevel* outLevels) {
+    classifyKernel<FloatPrecision>(microSieverts, count, outLevels);
+}
+
+void RadiationCalculator::getDangerPercentageBatch(const float* microSieverts, size_t count, int* outPercentages) {
+    // Puede diferir en un punto de la referencia double en los bordes de tramo
+    gaugeKernel<FloatPrecision>(microSieverts, count, outPercentages);
+}
+
+void RadiationCalculator::getSafeExposureTimeBatch(const double* microSieverts, size_t count, double* outHours) {
+    for (size_t i = 0; i < count; ++i) {
+        double v = microSieverts[i];
+        // Mismas comparaciones que la versión escalar, para que NaN se propague igual
+        double hours = v <= 0.0 ? HOURS_PER_YEAR : ANNUAL_LIMIT / v;
+        outHours[i] = hours > HOURS_PER_YEAR ? HOURS_PER_YEAR : hours;
     }
+}
+
+double RadiationCalculator::getDangerThreshold(DangerLevel level) {
+    int index = static_cast<int>(level);
+    return index >= 0 && index < 4 ? DANGER_THRESHOLDS[index] : 0.0;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef RADIATIONCALCULATOR_H
 #define RADIATIONCALCULATOR_H
 
+#include <cstddef>
 #include <string>
 
 enum class RadiationUnit {
@@ -21,6 +22,13 @@ class RadiationCalculator {
 public:
     RadiationCalculator();
     
+    // Límites de exposición del público
+    static constexpr double ANNUAL_LIMIT = 1000000.0; // 1 mSv/año en μSv
+    static constexpr double HOURS_PER_YEAR = 8760.0;
+    
+    // Umbrales inferiores de CAUTION, DANGEROUS, EXTREME y LETHAL (μSv/h)
+    static constexpr double DANGER_THRESHOLDS[4] = { 0.5, 2.0, 100.0, 1000.0 };
+    
     // Conversiones de unidades
     double convertToMicroSieverts(double value, RadiationUnit unit);
     std::string formatWithUnit(double microSieverts, RadiationUnit targetUnit);
@@ -40,9 +48,16 @@ public:
     // Validación de rangos
     bool isValidRadiationLevel(double value, RadiationUnit unit);
     
+    // Procesamiento por lotes (bucles sin ramas, vectorizables)
+    void classifyBatch(const double* microSieverts, size_t count, DangerLevel* outLevels);
+    void getDangerPercentageBatch(const double* microSieverts, size_t count, int* outPercentages);
+    
+    // Rutas float32 (ver PrecisionPolicy.h); convertir con FloatPrecision::fromMicroSieverts
+    void classifyBatch(const float* microSieverts, size_t count, DangerLevel* outLevels);
+    void getDangerPercentageBatch(const float* microSieverts, size_t count, int* outPercentages);
+    void getSafeExposureTimeBatch(const double* microSieverts, size_t count, double* outHours);
+    
 private:
-    double microSievertsToMilliSieverts(double microSieverts);
-    double microSievertsToSieverts(double microSieverts);
     double getDangerThreshold(DangerLevel level);
 };
 
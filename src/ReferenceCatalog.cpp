@@ -0,0 +1,291 @@
+#include "ReferenceCatalog.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    struct BuiltinReference {
+        const char* name;
+        ReferenceKind kind;
+        double microSievertsPerHour;
+    };
+
+    // Valores aproximados y redondeados, con fines educativos. Deben estar
+    // ordenados por tasa: se comprueba en compilación
+    constexpr BuiltinReference BUILTIN_REFERENCES[] = {
+        { "Dormir junto a otra persona",                      ReferenceKind::EVERYDAY_SOURCE,   0.006 },
+        { "Hiroshima (hoy)",                                  ReferenceKind::SITE,              0.08 },
+        { "Fondo natural típico",                             ReferenceKind::EVERYDAY_SOURCE,   0.1 },
+        { "1 plátano por hora",                               ReferenceKind::BANANA_EQUIVALENT, 0.1 },
+        { "Denver, EE. UU. (altitud)",                        ReferenceKind::SITE,              0.2 },
+        { "Estación Grand Central, Nueva York (granito)",     ReferenceKind::SITE,              0.3 },
+        { "Sótano con radón elevado",                         ReferenceKind::EVERYDAY_SOURCE,   0.5 },
+        { "Pripyat, Chernóbil (hoy)",                         ReferenceKind::SITE,              1.0 },
+        { "10 plátanos por hora",                             ReferenceKind::BANANA_EQUIVALENT, 1.0 },
+        { "Reloj con esfera de radio",                        ReferenceKind::EVERYDAY_SOURCE,   1.0 },
+        { "Fumador de 1,5 paquetes al día (promedio)",        ReferenceKind::EVERYDAY_SOURCE,   1.5 },
+        { "Kerala, India (arenas de monacita)",               ReferenceKind::SITE,              2.0 },
+        { "Vuelo comercial a 11 km",                          ReferenceKind::EVERYDAY_SOURCE,   4.0 },
+        { "Guarapari, Brasil (playas de monacita)",           ReferenceKind::SITE,              5.0 },
+        { "Camisa de farol con torio, en contacto",           ReferenceKind::EVERYDAY_SOURCE,   5.0 },
+        { "Ramsar, Irán (radiación natural alta)",            ReferenceKind::SITE,              10.0 },
+        { "Bosque Rojo, Chernóbil (hoy)",                     ReferenceKind::SITE,              10.0 },
+        { "100 plátanos por hora",                            ReferenceKind::BANANA_EQUIVALENT, 10.0 },
+        { "Vajilla Fiestaware naranja, en contacto",          ReferenceKind::EVERYDAY_SOURCE,   20.0 },
+        { "Fukushima, zona evacuada (2011)",                  ReferenceKind::SITE,              20.0 },
+        { "Estación Espacial Internacional",                  ReferenceKind::SITE,              25.0 },
+        { "Superficie de Marte",                              ReferenceKind::SITE,              28.0 },
+        { "1.000 plátanos por hora",                          ReferenceKind::BANANA_EQUIVALENT, 100.0 },
+        { "Fukushima Daiichi, perímetro (marzo 2011)",        ReferenceKind::SITE,              400.0 },
+        { "10.000 plátanos por hora",                         ReferenceKind::BANANA_EQUIVALENT, 1000.0 },
+        { "Chernóbil, tejado del reactor 3 (1986)",           ReferenceKind::SITE,              1.0e7 },
+        { "Pie de Elefante, Chernóbil (1986)",                ReferenceKind::SITE,              1.0e8 },
+        { "Contención del reactor 2 de Fukushima (2017)",     ReferenceKind::SITE,              5.3e8 },
+    };
+
+    constexpr size_t BUILTIN_COUNT = sizeof(BUILTIN_REFERENCES) / sizeof(BUILTIN_REFERENCES[0]);
+
+    constexpr bool isSortedByRate(const BuiltinReference* references, size_t count) {
+        for (size_t i = 1; i < count; ++i) {
+            if (references[i].microSievertsPerHour < references[i - 1].microSievertsPerHour) return false;
+        }
+        return true;
+    }
+
+    static_assert(isSortedByRate(BUILTIN_REFERENCES, BUILTIN_COUNT),
+                  "BUILTIN_REFERENCES debe estar ordenado por tasa de dosis");
+
+    const double MIN_RATE = 1e-9;
+    const uint32_t NO_MATCH = UINT32_MAX;
+
+    double safeLog10(double microSievertsPerHour) {
+        return std::log10(microSievertsPerHour > MIN_RATE ? microSievertsPerHour : MIN_RATE);
+    }
+
+    // Una lectura NaN o negativa no se compara con ninguna referencia
+    bool isComparableReading(double microSievertsPerHour) {
+        return microSievertsPerHour >= 0.0;
+    }
+
+    bool isValidRate(double microSievertsPerHour) {
+        return std::isfinite(microSievertsPerHour) && microSievertsPerHour > 0.0;
+    }
+
+    // Número decimal completo: "1.0abc", "0x10" o "" no son tasas
+    bool parseRate(const std::string& token, double& rate) {
+        const char* end = token.data() + token.size();
+        std::from_chars_result result = std::from_chars(token.data(), end, rate);
+        return result.ec == std::errc() && result.ptr == end;
+    }
+}
+
+ReferenceCatalog::ReferenceCatalog() {
+    references.reserve(BUILTIN_COUNT);
+    for (size_t i = 0; i < BUILTIN_COUNT; ++i) {
+        const BuiltinReference& builtin = BUILTIN_REFERENCES[i];
+        references.push_back({ builtin.name, builtin.kind, builtin.microSievertsPerHour });
+    }
+    rebuildIndex();
+}
+
+size_t ReferenceCatalog::getReferenceCount() {
+    return references.size();
+}
+
+const ReferencePoint& ReferenceCatalog::getReference(uint32_t index) {
+    return references[index];
+}
+
+bool ReferenceCatalog::addReference(const ReferencePoint& reference) {
+    if (reference.name.empty() || !isValidRate(reference.microSievertsPerHour)) {
+        lastError = "Referencia inválida: " + reference.name;
+        return false;
+    }
+
+    // Inserción ordenada: el catálogo sigue siendo un arreglo ordenado
+    auto position = std::upper_bound(references.begin(), references.end(), reference.microSievertsPerHour,
+        [](double rate, const ReferencePoint& point) { return rate < point.microSievertsPerHour; });
+    references.insert(position, reference);
+    rebuildIndex();
+    return true;
+}
+
+int ReferenceCatalog::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        lastError = "No se pudo abrir " + path;
+        return -1;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return loadFromString(contents.str());
+}
+
+int ReferenceCatalog::loadFromString(const std::string& contents) {
+    std::vector<ReferencePoint> loaded;
+    std::istringstream input(contents);
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') continue;
+
+        std::istringstream fields(line.substr(first));
+        std::string kindName;
+        std::string rateToken;
+        ReferencePoint reference;
+        fields >> kindName >> rateToken;
+        std::getline(fields >> std::ws, reference.name);
+        while (!reference.name.empty() && (reference.name.back() == '\r' || reference.name.back() == ' ')) {
+            reference.name.pop_back();
+        }
+
+        if (rateToken.empty() || reference.name.empty()) {
+            lastError = "Línea " + std::to_string(lineNumber) + ": formato esperado '<tipo> <μSv/h> <nombre>'";
+            return -1;
+        }
+        if (!parseKindName(kindName, reference.kind)) {
+            lastError = "Línea " + std::to_string(lineNumber) + ": tipo desconocido '" + kindName + "'";
+            return -1;
+        }
+        if (!parseRate(rateToken, reference.microSievertsPerHour) || !isValidRate(reference.microSievertsPerHour)) {
+            lastError = "Línea " + std::to_string(lineNumber) + ": tasa inválida '" + rateToken + "'";
+            return -1;
+        }
+        loaded.push_back(reference);
+    }
+
+    // Se valida todo el fichero antes de tocar el catálogo
+    references.insert(references.end(), loaded.begin(), loaded.end());
+    std::stable_sort(references.begin(), references.end(),
+        [](const ReferencePoint& a, const ReferencePoint& b) { return a.microSievertsPerHour < b.microSievertsPerHour; });
+    rebuildIndex();
+    return static_cast<int>(loaded.size());
+}
+
+const std::string& ReferenceCatalog::getLastError() {
+    return lastError;
+}
+
+std::vector<ReferenceMatch> ReferenceCatalog::findNearest(double microSievertsPerHour, size_t k, uint32_t kindMask) {
+    if (!isComparableReading(microSievertsPerHour)) return {};
+
+    std::vector<ReferenceMatch> matches(std::min(k, references.size()));
+    size_t found = collectNearest(safeLog10(microSievertsPerHour), matches.size(), kindMask, matches.data());
+    matches.resize(found);
+    for (ReferenceMatch& match : matches) {
+        match.ratio = microSievertsPerHour / references[match.index].microSievertsPerHour;
+    }
+    return matches;
+}
+
+void ReferenceCatalog::annotateBatch(const double* microSievertsPerHour, size_t count, size_t k,
+                                     ReferenceMatch* outMatches) {
+    for (size_t i = 0; i < count; ++i) {
+        ReferenceMatch* row = outMatches + i * k;
+        size_t found = isComparableReading(microSievertsPerHour[i])
+                     ? collectNearest(safeLog10(microSievertsPerHour[i]), k, ALL_KINDS, row) : 0;
+        for (size_t j = 0; j < found; ++j) {
+            row[j].ratio = microSievertsPerHour[i] / references[row[j].index].microSievertsPerHour;
+        }
+        for (size_t j = found; j < k; ++j) {
+            row[j] = { NO_MATCH, 0.0 };
+        }
+    }
+}
+
+std::string ReferenceCatalog::describeMatch(const ReferenceMatch& match) {
+    if (match.index >= references.size()) return "";
+
+    const ReferencePoint& reference = references[match.index];
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(match.ratio < 10.0 ? 1 : 0) << match.ratio << "× "
+        << reference.name << " (" << std::setprecision(reference.microSievertsPerHour < 1.0 ? 3 : 1)
+        << reference.microSievertsPerHour << " μSv/h)";
+    return oss.str();
+}
+
+double ReferenceCatalog::getBananaEquivalent(double microSieverts) {
+    return microSieverts / BANANA_EQUIVALENT_DOSE;
+}
+
+const char* ReferenceCatalog::getKindName(ReferenceKind kind) {
+    switch (kind) {
+        case ReferenceKind::SITE:
+            return "site";
+        case ReferenceKind::EVERYDAY_SOURCE:
+            return "source";
+        case ReferenceKind::BANANA_EQUIVALENT:
+            return "bed";
+        default:
+            return "";
+    }
+}
+
+bool ReferenceCatalog::parseKindName(const std::string& name, ReferenceKind& kind) {
+    for (ReferenceKind candidate : { ReferenceKind::SITE, ReferenceKind::EVERYDAY_SOURCE, ReferenceKind::BANANA_EQUIVALENT }) {
+        if (name == getKindName(candidate)) {
+            kind = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReferenceCatalog::rebuildIndex() {
+    logRates.resize(references.size());
+    for (size_t i = 0; i < references.size(); ++i) {
+        logRates[i] = safeLog10(references[i].microSievertsPerHour);
+    }
+
+    bucketStart.resize(BUCKET_COUNT);
+    for (int b = 0; b < BUCKET_COUNT; ++b) {
+        double bucketLog = MIN_DECADE + static_cast<double>(b) / BUCKETS_PER_DECADE;
+        bucketStart[b] = static_cast<uint32_t>(
+            std::lower_bound(logRates.begin(), logRates.end(), bucketLog) - logRates.begin());
+    }
+}
+
+size_t ReferenceCatalog::lowerBound(double logRate) {
+    double position = (logRate - MIN_DECADE) * BUCKETS_PER_DECADE;
+    if (!(position >= 0.0) || position >= BUCKET_COUNT) {
+        return std::lower_bound(logRates.begin(), logRates.end(), logRate) - logRates.begin();
+    }
+
+    // El cubo da un punto de partida exacto; dentro de él hay pocas entradas
+    size_t index = bucketStart[static_cast<int>(position)];
+    while (index < logRates.size() && logRates[index] < logRate) {
+        ++index;
+    }
+    return index;
+}
+
+size_t ReferenceCatalog::collectNearest(double logRate, size_t k, uint32_t kindMask, ReferenceMatch* out) {
+    // Dos punteros que se alejan del punto de inserción tomando siempre el
+    // vecino más cercano en escala logarítmica
+    size_t right = lowerBound(logRate);
+    size_t left = right;
+    size_t found = 0;
+
+    while (found < k && (left > 0 || right < logRates.size())) {
+        bool takeLeft;
+        if (left == 0) {
+            takeLeft = false;
+        } else if (right >= logRates.size()) {
+            takeLeft = true;
+        } else {
+            takeLeft = logRate - logRates[left - 1] <= logRates[right] - logRate;
+        }
+
+        size_t index = takeLeft ? --left : right++;
+        if (kindMask & (1u << static_cast<int>(references[index].kind))) {
+            out[found++] = { static_cast<uint32_t>(index), 0.0 };
+        }
+    }
+    return found;
+}
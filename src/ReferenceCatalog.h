@@ -0,0 +1,88 @@
+#ifndef REFERENCECATALOG_H
+#define REFERENCECATALOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class ReferenceKind {
+    SITE,                // Lugares históricos y zonas conocidas
+    EVERYDAY_SOURCE,     // Fuentes cotidianas (vuelos, objetos, edificios)
+    BANANA_EQUIVALENT    // Múltiplos de la dosis equivalente a un plátano por hora
+};
+
+struct ReferencePoint {
+    std::string name;
+    ReferenceKind kind;
+    double microSievertsPerHour;
+};
+
+struct ReferenceMatch {
+    uint32_t index;       // Posición en el catálogo (getReference)
+    double ratio;         // Lectura / referencia
+};
+
+// Catálogo de puntos de referencia ordenado por tasa de dosis. El
+// catálogo base se compila en el binario como un arreglo ordenado; las
+// búsquedas de los k más cercanos se hacen por distancia en escala
+// logarítmica (3 μSv/h está igual de lejos de 1 que de 9).
+//
+// Formato del fichero de ampliación, una referencia por línea:
+//     <site|source|bed> <μSv/h> <nombre>
+// Las líneas vacías y las que empiezan por '#' se ignoran.
+class ReferenceCatalog {
+public:
+    static constexpr double BANANA_EQUIVALENT_DOSE = 0.1;  // μSv por plátano
+    static const uint32_t ALL_KINDS = 0x7;
+
+    ReferenceCatalog();
+
+    size_t getReferenceCount();
+    const ReferencePoint& getReference(uint32_t index);
+
+    // Ampliación sin recompilar
+    bool addReference(const ReferencePoint& reference);
+    int loadFromFile(const std::string& path);          // Devuelve las líneas cargadas o -1
+    int loadFromString(const std::string& contents);
+    const std::string& getLastError();
+
+    // k referencias más cercanas, de la más próxima a la más lejana.
+    // kindMask combina (1 << ReferenceKind) para filtrar por tipo. Una
+    // lectura NaN o negativa no tiene referencias cercanas
+    std::vector<ReferenceMatch> findNearest(double microSievertsPerHour, size_t k,
+                                            uint32_t kindMask = ALL_KINDS);
+
+    // Anota una columna completa: outMatches recibe count * k entradas
+    // (índice UINT32_MAX y razón 0 si el catálogo tiene menos de k o si
+    // la lectura es NaN o negativa)
+    void annotateBatch(const double* microSievertsPerHour, size_t count, size_t k,
+                       ReferenceMatch* outMatches);
+
+    // "3.2× Vuelo comercial (4.0 μSv/h)"
+    std::string describeMatch(const ReferenceMatch& match);
+
+    // Equivalencias en plátanos (BED)
+    static double getBananaEquivalent(double microSieverts);
+    static const char* getKindName(ReferenceKind kind);
+    static bool parseKindName(const std::string& name, ReferenceKind& kind);
+
+private:
+    // Índice de búsqueda en log10: cubos de 1/16 de década con el primer
+    // elemento de cada cubo, para evitar la búsqueda binaria en los lotes
+    static const int BUCKETS_PER_DECADE = 16;
+    static const int MIN_DECADE = -4;
+    static const int MAX_DECADE = 10;
+    static const int BUCKET_COUNT = (MAX_DECADE - MIN_DECADE) * BUCKETS_PER_DECADE + 1;
+
+    std::vector<ReferencePoint> references;
+    std::vector<double> logRates;               // log10 de la tasa, mismo orden
+    std::vector<uint32_t> bucketStart;
+    std::string lastError;
+
+    void rebuildIndex();
+    size_t lowerBound(double logRate);
+    size_t collectNearest(double logRate, size_t k, uint32_t kindMask, ReferenceMatch* out);
+};
+
+#endif // REFERENCECATALOG_H
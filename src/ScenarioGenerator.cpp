@@ -0,0 +1,225 @@
+#include "ScenarioGenerator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const double TWO_PI = 6.28318530717958647692;
+    const double LN2 = 0.69314718055994530942;
+    const double NANOSECONDS_PER_HOUR = 3.6e12;
+
+    uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+}
+
+ScenarioRandom::ScenarioRandom(uint64_t seed) {
+    for (int i = 0; i < 4; ++i) {
+        state[i] = splitmix64(seed);
+    }
+}
+
+uint64_t ScenarioRandom::next() {
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+double ScenarioRandom::nextDouble() {
+    return (next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double ScenarioRandom::nextRange(double low, double high) {
+    return low + (high - low) * nextDouble();
+}
+
+double ScenarioRandom::nextLogUniform(double low, double high) {
+    return low * std::exp(std::log(high / low) * nextDouble());
+}
+
+double ScenarioRandom::nextGaussian() {
+    // Box-Muller; 1 - u evita log(0)
+    double u1 = 1.0 - nextDouble();
+    double u2 = nextDouble();
+    return std::sqrt(-2.0 * std::log(u1)) * std::cos(TWO_PI * u2);
+}
+
+ScenarioGenerator::ScenarioGenerator(const ScenarioConfig& scenarioConfig)
+    : config(scenarioConfig), random(scenarioConfig.seed), sampleIndex(0), nextSensor(0) {
+    config.sensorCount = std::max<uint32_t>(1, config.sensorCount);
+    config.samplesPerSecond = std::max(1.0, config.samplesPerSecond);
+    config.scenarioHours = std::max(1e-6, config.scenarioHours);
+    nanosecondsPerSample = 1e9 / config.samplesPerSecond;
+
+    double side = config.areaKilometers;
+    sensorX.resize(config.sensorCount);
+    sensorY.resize(config.sensorCount);
+    sensorBackground.resize(config.sensorCount);
+    for (uint32_t i = 0; i < config.sensorCount; ++i) {
+        sensorX[i] = random.nextRange(0.0, side);
+        sensorY[i] = random.nextRange(0.0, side);
+        sensorBackground[i] = config.backgroundMicroSieverts *
+                              std::exp(config.backgroundSpread * random.nextGaussian());
+    }
+
+    // Las plumas entran por un borde y cruzan la zona; su pico se reparte
+    // en escala logarítmica para que recorran todas las bandas de peligro
+    for (uint32_t i = 0; i < config.plumeCount; ++i) {
+        Plume plume;
+        plume.durationHours = config.scenarioHours * random.nextRange(0.1, 0.4);
+        plume.startHours = random.nextRange(0.0, config.scenarioHours - plume.durationHours);
+        double angle = random.nextRange(0.0, TWO_PI);
+        double speed = side * 1.5 / plume.durationHours;
+        plume.velocityX = speed * std::cos(angle);
+        plume.velocityY = speed * std::sin(angle);
+        plume.startX = side * 0.5 - plume.velocityX * plume.durationHours * 0.5;
+        plume.startY = side * 0.5 - plume.velocityY * plume.durationHours * 0.5;
+        plume.widthKm = side * random.nextRange(0.05, 0.2);
+        plume.peakMicroSieverts = random.nextLogUniform(1.0, 5000.0);
+        plumes.push_back(plume);
+    }
+
+    for (uint32_t i = 0; i < config.hotspotCount; ++i) {
+        Hotspot hotspot;
+        hotspot.startHours = random.nextRange(0.0, config.scenarioHours);
+        hotspot.x = random.nextRange(0.0, side);
+        hotspot.y = random.nextRange(0.0, side);
+        hotspot.radiusKm = random.nextRange(0.05, 0.5);
+        hotspot.initialMicroSieverts = random.nextLogUniform(10.0, 20000.0);
+        hotspot.decayPerHour = LN2 / random.nextLogUniform(0.1, 100.0);
+        hotspots.push_back(hotspot);
+    }
+
+    // Acoplamiento geométrico sensor-foco, fijo durante todo el escenario
+    hotspotCoupling.resize(static_cast<size_t>(config.sensorCount) * hotspots.size());
+    for (uint32_t s = 0; s < config.sensorCount; ++s) {
+        for (size_t h = 0; h < hotspots.size(); ++h) {
+            double dx = sensorX[s] - hotspots[h].x;
+            double dy = sensorY[s] - hotspots[h].y;
+            double r = hotspots[h].radiusKm;
+            hotspotCoupling[s * hotspots.size() + h] = 1.0 / (1.0 + (dx * dx + dy * dy) / (r * r));
+        }
+    }
+
+    plumeX.resize(plumes.size());
+    plumeY.resize(plumes.size());
+    plumeIntensity.resize(plumes.size());
+    hotspotIntensity.resize(hotspots.size());
+    updateTimeState(0.0);
+}
+
+const ScenarioConfig& ScenarioGenerator::getConfig() {
+    return config;
+}
+
+uint64_t ScenarioGenerator::getSamplesGenerated() {
+    return sampleIndex;
+}
+
+int64_t ScenarioGenerator::getNextTimestampNs() {
+    return static_cast<int64_t>(sampleIndex * nanosecondsPerSample);
+}
+
+void ScenarioGenerator::generate(DoseRateSample* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        int64_t timestamp = getNextTimestampNs();
+        if (nextSensor == 0) {
+            // Una vuelta completa dura sensorCount / samplesPerSecond: las
+            // plumas y los focos cambian muy poco en ese intervalo
+            updateTimeState(timestamp / NANOSECONDS_PER_HOUR);
+        }
+
+        out[i].timestampNs = timestamp;
+        out[i].sensorId = nextSensor;
+        out[i].microSievertsPerHour = sampleSensor(nextSensor);
+
+        ++sampleIndex;
+        nextSensor = nextSensor + 1 < config.sensorCount ? nextSensor + 1 : 0;
+    }
+}
+
+std::vector<DoseRateSample> ScenarioGenerator::generate(size_t count) {
+    std::vector<DoseRateSample> samples(count);
+    generate(samples.data(), count);
+    return samples;
+}
+
+double ScenarioGenerator::getFieldAt(double xKm, double yKm, double hours) {
+    double field = 0.0;
+    for (const Plume& plume : plumes) {
+        double t = hours - plume.startHours;
+        double dx = xKm - (plume.startX + plume.velocityX * t);
+        double dy = yKm - (plume.startY + plume.velocityY * t);
+        field += plumeEnvelope(plume, hours) * std::exp(-(dx * dx + dy * dy) / (2.0 * plume.widthKm * plume.widthKm));
+    }
+    for (const Hotspot& hotspot : hotspots) {
+        double dx = xKm - hotspot.x;
+        double dy = yKm - hotspot.y;
+        double r = hotspot.radiusKm;
+        field += hotspotDecay(hotspot, hours) / (1.0 + (dx * dx + dy * dy) / (r * r));
+    }
+    return field;
+}
+
+double ScenarioGenerator::plumeEnvelope(const Plume& plume, double hours) {
+    // Envolvente triangular: crece, alcanza el pico a mitad de paso y se disipa
+    double phase = (hours - plume.startHours) / plume.durationHours;
+    double envelope = (phase > 0.0 && phase < 1.0) ? 1.0 - std::fabs(2.0 * phase - 1.0) : 0.0;
+    return plume.peakMicroSieverts * envelope;
+}
+
+double ScenarioGenerator::hotspotDecay(const Hotspot& hotspot, double hours) {
+    double t = hours - hotspot.startHours;
+    return t >= 0.0 ? hotspot.initialMicroSieverts * std::exp(-hotspot.decayPerHour * t) : 0.0;
+}
+
+void ScenarioGenerator::updateTimeState(double hours) {
+    for (size_t p = 0; p < plumes.size(); ++p) {
+        const Plume& plume = plumes[p];
+        double t = hours - plume.startHours;
+        plumeX[p] = plume.startX + plume.velocityX * t;
+        plumeY[p] = plume.startY + plume.velocityY * t;
+        plumeIntensity[p] = plumeEnvelope(plume, hours);
+    }
+    for (size_t h = 0; h < hotspots.size(); ++h) {
+        hotspotIntensity[h] = hotspotDecay(hotspots[h], hours);
+    }
+}
+
+double ScenarioGenerator::sampleSensor(uint32_t sensor) {
+    double value = sensorBackground[sensor] * (1.0 + config.noiseFraction * random.nextGaussian());
+
+    double x = sensorX[sensor];
+    double y = sensorY[sensor];
+    for (size_t p = 0; p < plumes.size(); ++p) {
+        if (plumeIntensity[p] <= 0.0) continue;
+        double dx = x - plumeX[p];
+        double dy = y - plumeY[p];
+        double w = plumes[p].widthKm;
+        value += plumeIntensity[p] * std::exp(-(dx * dx + dy * dy) / (2.0 * w * w));
+    }
+
+    const double* coupling = hotspotCoupling.data() + static_cast<size_t>(sensor) * hotspots.size();
+    for (size_t h = 0; h < hotspots.size(); ++h) {
+        value += hotspotIntensity[h] * coupling[h];
+    }
+
+    // Ruido de conteo proporcional a la lectura y picos aislados
+    value *= 1.0 + config.noiseFraction * 0.5 * random.nextGaussian();
+    if (random.nextDouble() < config.spikeProbability) {
+        value *= random.nextLogUniform(10.0, std::max(10.0, config.spikeMaxMultiplier));
+    }
+    return std::max(0.0, value);
+}
@@ -0,0 +1,117 @@
+#ifndef SCENARIOGENERATOR_H
+#define SCENARIOGENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct ScenarioConfig {
+    uint64_t seed = 2287;
+    uint32_t sensorCount = 1000;
+    double samplesPerSecond = 100000.0;   // Tasa agregada de todos los sensores
+    double areaKilometers = 20.0;         // Lado del cuadrado donde se reparten
+
+    // Fondo natural: media log-normal y dispersión relativa de la lectura
+    double backgroundMicroSieverts = 0.15;
+    double backgroundSpread = 0.3;
+    double noiseFraction = 0.05;
+
+    // Picos aislados (descargas, ruido eléctrico)
+    double spikeProbability = 1e-4;
+    double spikeMaxMultiplier = 1000.0;
+
+    // Plumas que cruzan la zona y focos que decaen
+    uint32_t plumeCount = 4;
+    uint32_t hotspotCount = 8;
+    double scenarioHours = 1.0;           // Horizonte en el que se reparten los eventos
+};
+
+struct DoseRateSample {
+    int64_t timestampNs;       // Tiempo del escenario desde el inicio
+    uint32_t sensorId;
+    double microSievertsPerHour;
+};
+
+// Generador pseudoaleatorio propio (xoshiro256** sembrado con splitmix64)
+// para que un mismo seed produzca la misma secuencia en cualquier
+// plataforma y biblioteca estándar.
+class ScenarioRandom {
+public:
+    explicit ScenarioRandom(uint64_t seed);
+
+    uint64_t next();
+    double nextDouble();                    // [0, 1)
+    double nextRange(double low, double high);
+    double nextLogUniform(double low, double high);
+    double nextGaussian();
+
+private:
+    uint64_t state[4];
+};
+
+// Genera lecturas de tasa de dosis con marca de tiempo para miles de
+// sensores: fondo con ruido, picos, plumas en movimiento que atraviesan
+// las bandas de peligro y focos que decaen con su periodo. Las muestras
+// se reparten entre los sensores por turnos, así que cada sensor informa
+// a samplesPerSecond / sensorCount.
+class ScenarioGenerator {
+public:
+    explicit ScenarioGenerator(const ScenarioConfig& config);
+
+    const ScenarioConfig& getConfig();
+    uint64_t getSamplesGenerated();
+    int64_t getNextTimestampNs();
+
+    // Rellena las siguientes count muestras del escenario
+    void generate(DoseRateSample* out, size_t count);
+    std::vector<DoseRateSample> generate(size_t count);
+
+    // Tasa sin ruido en un punto e instante dados (μSv/h)
+    double getFieldAt(double xKm, double yKm, double hours);
+
+private:
+    struct Plume {
+        double startHours;
+        double durationHours;
+        double startX, startY;
+        double velocityX, velocityY;     // km/h
+        double widthKm;
+        double peakMicroSieverts;
+    };
+
+    struct Hotspot {
+        double startHours;
+        double x, y;
+        double radiusKm;
+        double initialMicroSieverts;
+        double decayPerHour;             // ln2 / periodo
+    };
+
+    ScenarioConfig config;
+    ScenarioRandom random;
+    std::vector<Plume> plumes;
+    std::vector<Hotspot> hotspots;
+
+    // Sensores en estructura de arrays
+    std::vector<double> sensorX;
+    std::vector<double> sensorY;
+    std::vector<double> sensorBackground;
+    std::vector<double> hotspotCoupling;  // [sensor * hotspotCount + foco]
+
+    // Estado dependiente del tiempo, recalculado al empezar cada vuelta
+    std::vector<double> plumeX;
+    std::vector<double> plumeY;
+    std::vector<double> plumeIntensity;
+    std::vector<double> hotspotIntensity;
+
+    uint64_t sampleIndex;
+    uint32_t nextSensor;
+    double nanosecondsPerSample;
+
+    static double plumeEnvelope(const Plume& plume, double hours);
+    static double hotspotDecay(const Hotspot& hotspot, double hours);
+    void updateTimeState(double hours);
+    double sampleSensor(uint32_t sensor);
+};
+
+#endif // SCENARIOGENERATOR_H
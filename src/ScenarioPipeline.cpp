@@ -0,0 +1,252 @@
+#include "ScenarioPipeline.h"
+#include "HealthEffectAnalyzer.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    struct SampleBatch {
+        std::vector<DoseRateSample> samples;
+        std::vector<double> rates;
+        std::vector<DangerLevel> levels;
+        size_t count;
+        int64_t originNs;      // Referencia para la latencia extremo a extremo
+        int64_t enqueuedNs;    // Entrada en la cola de la etapa actual
+    };
+
+    // Cola acotada con bloqueo; close() despierta a los consumidores cuando
+    // el productor termina
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(size_t capacity) : capacity(std::max<size_t>(1, capacity)), closed(false) {}
+
+        void push(SampleBatch* batch) {
+            std::unique_lock<std::mutex> lock(mutex);
+            notFull.wait(lock, [this]() { return items.size() < capacity; });
+            items.push_back(batch);
+            notEmpty.notify_one();
+        }
+
+        // Devuelve nullptr cuando la cola está cerrada y vacía
+        SampleBatch* pop(size_t& depthBeforePop) {
+            std::unique_lock<std::mutex> lock(mutex);
+            notEmpty.wait(lock, [this]() { return !items.empty() || closed; });
+            depthBeforePop = items.size();
+            if (items.empty()) return nullptr;
+            SampleBatch* batch = items.front();
+            items.pop_front();
+            notFull.notify_one();
+            return batch;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+            notEmpty.notify_all();
+        }
+
+    private:
+        size_t capacity;
+        bool closed;
+        std::deque<SampleBatch*> items;
+        std::mutex mutex;
+        std::condition_variable notEmpty;
+        std::condition_variable notFull;
+    };
+
+    struct StageStats {
+        uint64_t samples = 0;
+        uint64_t batches = 0;
+        int64_t busyNs = 0;
+        size_t maxQueueDepth = 0;
+        uint64_t queueDepthSum = 0;
+        std::vector<int64_t> latenciesNs;
+
+        void record(const SampleBatch& batch, int64_t busy, int64_t latency, size_t queueDepth) {
+            samples += batch.count;
+            ++batches;
+            busyNs += busy;
+            latenciesNs.push_back(latency);
+            maxQueueDepth = std::max(maxQueueDepth, queueDepth);
+            queueDepthSum += queueDepth;
+        }
+    };
+
+    double percentileUs(std::vector<int64_t>& values, double fraction) {
+        if (values.empty()) return 0.0;
+        size_t index = std::min(values.size() - 1, static_cast<size_t>(fraction * values.size()));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index] / 1000.0;
+    }
+
+    StageReport makeStageReport(const char* name, StageStats& stats) {
+        StageReport report;
+        report.name = name;
+        report.samples = stats.samples;
+        report.batches = stats.batches;
+        report.busySeconds = stats.busyNs / 1e9;
+        report.latencyP50Us = percentileUs(stats.latenciesNs, 0.50);
+        report.latencyP99Us = percentileUs(stats.latenciesNs, 0.99);
+        report.latencyMaxUs = stats.latenciesNs.empty() ? 0.0 :
+            *std::max_element(stats.latenciesNs.begin(), stats.latenciesNs.end()) / 1000.0;
+        report.maxQueueDepth = stats.maxQueueDepth;
+        report.meanQueueDepth = stats.batches > 0 ? static_cast<double>(stats.queueDepthSum) / stats.batches : 0.0;
+        return report;
+    }
+}
+
+ScenarioPipeline::ScenarioPipeline(const ScenarioConfig& scenario, const PipelineConfig& pipeline)
+    : scenarioConfig(scenario), pipelineConfig(pipeline) {
+}
+
+const char* ScenarioPipeline::getPacingName(PacingMode mode) {
+    return mode == PacingMode::REAL_TIME ? "real_time" : "as_fast_as_possible";
+}
+
+PipelineReport ScenarioPipeline::run() {
+    ScenarioGenerator generator(scenarioConfig);
+    const ScenarioConfig& scenario = generator.getConfig();
+    bool realTime = pipelineConfig.pacing == PacingMode::REAL_TIME;
+
+    size_t batchSize = std::max<size_t>(1, pipelineConfig.batchSize);
+    if (realTime) {
+        // Sin este límite, a tasas bajas un lote tardaría segundos en llenarse
+        size_t perWindow = static_cast<size_t>(scenario.samplesPerSecond * pipelineConfig.maxBatchMillis / 1000.0);
+        batchSize = std::min(batchSize, std::max<size_t>(1, perWindow));
+    }
+    uint64_t totalSamples = static_cast<uint64_t>(scenario.samplesPerSecond * pipelineConfig.durationSeconds);
+
+    // Lotes reciclados: dos colas llenas más los que están en proceso
+    size_t capacity = std::max<size_t>(1, pipelineConfig.queueCapacity);
+    std::vector<SampleBatch> pool(capacity * 2 + 3);
+    BoundedQueue freeBatches(pool.size());
+    BoundedQueue toClassify(capacity);
+    BoundedQueue toAnalyze(capacity);
+    for (SampleBatch& batch : pool) {
+        batch.samples.resize(batchSize);
+        batch.rates.resize(batchSize);
+        batch.levels.resize(batchSize);
+        freeBatches.push(&batch);
+    }
+
+    StageStats generateStats;
+    StageStats classifyStats;
+    StageStats analyzeStats;
+    std::vector<int64_t> endToEndNs;
+    uint64_t lateBatches = 0;
+
+    PipelineReport report = {};
+    int64_t startNs = nowNs();
+
+    std::thread generateThread([&]() {
+        uint64_t produced = 0;
+        size_t unused = 0;
+        while (produced < totalSamples) {
+            SampleBatch* batch = freeBatches.pop(unused);
+            int64_t begin = nowNs();
+            batch->count = static_cast<size_t>(std::min<uint64_t>(batchSize, totalSamples - produced));
+            generator.generate(batch->samples.data(), batch->count);
+            produced += batch->count;
+            int64_t end = nowNs();
+
+            if (realTime) {
+                // La última muestra del lote no existe hasta su marca de tiempo
+                int64_t dueNs = startNs + batch->samples[batch->count - 1].timestampNs;
+                if (end < dueNs) {
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(dueNs - end));
+                } else if (end - dueNs > static_cast<int64_t>(pipelineConfig.maxBatchMillis * 1e6)) {
+                    ++lateBatches;
+                }
+                batch->originNs = startNs + batch->samples[0].timestampNs;
+            } else {
+                batch->originNs = begin;
+            }
+
+            generateStats.record(*batch, end - begin, end - begin, 0);
+            batch->enqueuedNs = nowNs();
+            toClassify.push(batch);
+        }
+        toClassify.close();
+    });
+
+    std::thread classifyThread([&]() {
+        RadiationCalculator calculator;
+        size_t depth = 0;
+        while (SampleBatch* batch = toClassify.pop(depth)) {
+            int64_t begin = nowNs();
+            for (size_t i = 0; i < batch->count; ++i) {
+                batch->rates[i] = batch->samples[i].microSievertsPerHour;
+            }
+            calculator.classifyBatch(batch->rates.data(), batch->count, batch->levels.data());
+            int64_t end = nowNs();
+
+            classifyStats.record(*batch, end - begin, end - batch->enqueuedNs, depth);
+            batch->enqueuedNs = nowNs();
+            toAnalyze.push(batch);
+        }
+        toAnalyze.close();
+    });
+
+    std::thread analyzeThread([&]() {
+        HealthEffectAnalyzer analyzer;
+        std::vector<DangerLevel> lastLevel(scenario.sensorCount, DangerLevel::SAFE);
+        std::vector<double> sensorDose(scenario.sensorCount, 0.0);
+        double hoursPerReading = scenario.sensorCount / scenario.samplesPerSecond / 3600.0;
+        size_t depth = 0;
+
+        while (SampleBatch* batch = toAnalyze.pop(depth)) {
+            int64_t begin = nowNs();
+            for (size_t i = 0; i < batch->count; ++i) {
+                uint32_t sensor = batch->samples[i].sensorId;
+                double rate = batch->rates[i];
+                DangerLevel level = batch->levels[i];
+
+                sensorDose[sensor] += rate * hoursPerReading;
+                report.levelCounts[static_cast<int>(level)]++;
+                report.peakMicroSievertsPerHour = std::max(report.peakMicroSievertsPerHour, rate);
+
+                // Solo las transiciones a niveles peligrosos generan análisis
+                // completo, como haría la alarma de la aplicación
+                if (level >= DangerLevel::DANGEROUS && lastLevel[sensor] < DangerLevel::DANGEROUS) {
+                    analyzer.analyzeEffects(rate, 1.0);
+                    ++report.alerts;
+                }
+                lastLevel[sensor] = level;
+            }
+            int64_t end = nowNs();
+
+            analyzeStats.record(*batch, end - begin, end - batch->enqueuedNs, depth);
+            endToEndNs.push_back(end - batch->originNs);
+            freeBatches.push(batch);
+        }
+
+        for (double dose : sensorDose) {
+            report.maxSensorDoseMicroSieverts = std::max(report.maxSensorDoseMicroSieverts, dose);
+        }
+    });
+
+    generateThread.join();
+    classifyThread.join();
+    analyzeThread.join();
+
+    report.samples = analyzeStats.samples;
+    report.elapsedSeconds = (nowNs() - startNs) / 1e9;
+    report.samplesPerSecond = report.elapsedSeconds > 0.0 ? report.samples / report.elapsedSeconds : 0.0;
+    report.stages.push_back(makeStageReport("generate", generateStats));
+    report.stages.push_back(makeStageReport("classify", classifyStats));
+    report.stages.push_back(makeStageReport("analyze", analyzeStats));
+    report.endToEndP50Us = percentileUs(endToEndNs, 0.50);
+    report.endToEndP99Us = percentileUs(endToEndNs, 0.99);
+    report.endToEndMaxUs = endToEndNs.empty() ? 0.0 : *std::max_element(endToEndNs.begin(), endToEndNs.end()) / 1000.0;
+    report.lateBatches = lateBatches;
+    return report;
+}
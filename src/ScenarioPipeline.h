@@ -0,0 +1,73 @@
+#ifndef SCENARIOPIPELINE_H
+#define SCENARIOPIPELINE_H
+
+#include "ScenarioGenerator.h"
+#include "RadiationCalculator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class PacingMode {
+    REAL_TIME,            // Cada muestra se entrega cuando llega su marca de tiempo
+    AS_FAST_AS_POSSIBLE
+};
+
+struct PipelineConfig {
+    PacingMode pacing = PacingMode::AS_FAST_AS_POSSIBLE;
+    double durationSeconds = 10.0;   // Tiempo de escenario a generar
+    size_t batchSize = 4096;
+    double maxBatchMillis = 1.0;     // En tiempo real, límite de espera para llenar un lote
+    size_t queueCapacity = 32;       // Lotes por cola entre etapas
+};
+
+struct StageReport {
+    std::string name;
+    uint64_t samples;
+    uint64_t batches;
+    double busySeconds;
+    double latencyP50Us;     // Desde que el lote entra en la cola de la etapa hasta que sale
+    double latencyP99Us;
+    double latencyMaxUs;
+    size_t maxQueueDepth;
+    double meanQueueDepth;
+};
+
+struct PipelineReport {
+    uint64_t samples;
+    double elapsedSeconds;
+    double samplesPerSecond;
+    std::vector<StageReport> stages;
+
+    // Extremo a extremo: desde la primera muestra del lote (su marca de
+    // tiempo en tiempo real, o el inicio de su generación) hasta el análisis
+    double endToEndP50Us;
+    double endToEndP99Us;
+    double endToEndMaxUs;
+
+    uint64_t levelCounts[5];
+    uint64_t alerts;                 // Transiciones de un sensor a DANGEROUS o peor
+    double peakMicroSievertsPerHour;
+    double maxSensorDoseMicroSieverts;
+    uint64_t lateBatches;            // Tiempo real: lotes entregados tras su plazo
+};
+
+// Banco de carga: el generador de escenarios alimenta una cadena de tres
+// etapas en hilos separados (generar → clasificar con RadiationCalculator
+// → analizar con HealthEffectAnalyzer) unidas por colas acotadas. Los
+// lotes se reciclan, así que una etapa lenta frena a las anteriores en
+// lugar de acumular memoria.
+class ScenarioPipeline {
+public:
+    ScenarioPipeline(const ScenarioConfig& scenario, const PipelineConfig& pipeline);
+
+    PipelineReport run();
+
+    static const char* getPacingName(PacingMode mode);
+
+private:
+    ScenarioConfig scenarioConfig;
+    PipelineConfig pipelineConfig;
+};
+
+#endif // SCENARIOPIPELINE_H
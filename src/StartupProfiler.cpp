@@ -0,0 +1,91 @@
+#include "StartupProfiler.h"
+#include <QDebug>
+#include <QEvent>
+#include <QFile>
+#include <QTextStream>
+#include <QTimer>
+#include <QWidget>
+#include <QtGlobal>
+
+StartupProfiler::StartupProfiler() : firstFrameNanoseconds(-1) {
+}
+
+StartupProfiler& StartupProfiler::instance() {
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+void StartupProfiler::start() {
+    phases.clear();
+    firstFrameNanoseconds = -1;
+    clock.start();
+}
+
+void StartupProfiler::markPhase(const QString& name) {
+    if (!clock.isValid()) return;
+
+    qint64 now = clock.nsecsElapsed();
+    qint64 previous = phases.isEmpty() ? 0 : phases.last().endNanoseconds;
+    phases.append({ name, now, now - previous });
+}
+
+void StartupProfiler::watchFirstFrame(QWidget* window) {
+    if (window) {
+        window->installEventFilter(this);
+    }
+}
+
+bool StartupProfiler::hasFirstFrame() {
+    return firstFrameNanoseconds >= 0;
+}
+
+double StartupProfiler::getTimeToFirstFrameMs() {
+    return hasFirstFrame() ? firstFrameNanoseconds / 1e6 : -1.0;
+}
+
+QVector<StartupPhase> StartupProfiler::getPhases() {
+    return phases;
+}
+
+QString StartupProfiler::formatReport() {
+    QString report = "[ARRANQUE] Perfil de inicio\n";
+    for (const StartupPhase& phase : phases) {
+        report += QString("  %1 %2 ms (total %3 ms)\n")
+            .arg(phase.name + ":", -28)
+            .arg(phase.durationNanoseconds / 1e6, 8, 'f', 2)
+            .arg(phase.endNanoseconds / 1e6, 8, 'f', 2);
+    }
+    if (hasFirstFrame()) {
+        report += QString("  Tiempo hasta el primer frame: %1 ms\n")
+            .arg(getTimeToFirstFrameMs(), 0, 'f', 2);
+    }
+    return report;
+}
+
+bool StartupProfiler::eventFilter(QObject* watched, QEvent* event) {
+    if (event->type() == QEvent::Paint && !hasFirstFrame()) {
+        // El evento de pintado aún no ha terminado: se toma la marca después
+        // de que el frame llegue a la pantalla, en la siguiente vuelta del bucle
+        watched->removeEventFilter(this);
+        QTimer::singleShot(0, this, [this]() {
+            markPhase("Primer frame");
+            firstFrameNanoseconds = clock.nsecsElapsed();
+            writeReport();
+        });
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void StartupProfiler::writeReport() {
+    QString report = formatReport();
+    qInfo().noquote() << report.trimmed();
+
+    QString logPath = qEnvironmentVariable("RADMON_STARTUP_LOG");
+    if (logPath.isEmpty()) return;
+
+    QFile file(logPath);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        QTextStream out(&file);
+        out << report;
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+class QWidget;
+
+struct StartupPhase {
+    QString name;
+    qint64 endNanoseconds;      // Desde el inicio del proceso de arranque
+    qint64 durationNanoseconds; // Desde la fase anterior
+};
+
+// Perfilador de arranque: registra el final de cada fase y el tiempo hasta
+// el primer frame pintado de la ventana principal. Al llegar el primer
+// frame escribe el resumen con qInfo() y, si la variable de entorno
+// RADMON_STARTUP_LOG apunta a un fichero, lo añade allí también.
+class StartupProfiler : public QObject {
+    Q_OBJECT
+
+public:
+    static StartupProfiler& instance();
+
+    void start();
+    void markPhase(const QString& name);
+
+    // Observa el primer evento de pintado de la ventana
+    void watchFirstFrame(QWidget* window);
+
+    bool hasFirstFrame();
+    double getTimeToFirstFrameMs();
+    QVector<StartupPhase> getPhases();
+    QString formatReport();
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    StartupProfiler();
+
+    QElapsedTimer clock;
+    QVector<StartupPhase> phases;
+    qint64 firstFrameNanoseconds;
+
+    void writeReport();
+};
+
+#endif // STARTUPPROFILER_H
@@ -0,0 +1,215 @@
+#include "UnitRegistry.h"
+#include "ReferenceCatalog.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace {
+    UnitRegistry makeDefaultRegistry() {
+        UnitRegistry registry;
+        registry.freeze();
+        return registry;
+    }
+}
+
+UnitRegistry::UnitRegistry() : frozen(false) {
+    // Tasas de dosis. Las tres primeras siguen el orden de RadiationUnit
+    registerUnit({ "μSv/h", "Sv/h", UnitQuantity::DOSE_RATE, 1.0, 0.0, 1 });
+    registerUnit({ "mSv/h", "Sv/h", UnitQuantity::DOSE_RATE, 1000.0, 0.0, 3 });
+    registerUnit({ "Sv/h", "Sv/h", UnitQuantity::DOSE_RATE, 1000000.0, 0.0, 6 });
+
+    // Unidades tradicionales: 1 rem = 0.01 Sv
+    int microRemPerHour = registerUnit({ "μrem/h", "rem/h", UnitQuantity::DOSE_RATE, 0.01, 0.0, 1 });
+    int milliRemPerHour = registerUnit({ "mrem/h", "rem/h", UnitQuantity::DOSE_RATE, 10.0, 0.0, 3 });
+    int remPerHour = registerUnit({ "rem/h", "rem/h", UnitQuantity::DOSE_RATE, 10000.0, 0.0, 6 });
+
+    // Dosis absorbida con factor de ponderación w_R (ICRP 103): fotones y
+    // electrones 1, neutrones ~10 (depende de la energía), alfa 20
+    registerAbsorbedDoseRateUnit("μGy/h", 1.0, 1.0);
+    registerAbsorbedDoseRateUnit("mGy/h", 1000.0, 1.0);
+    registerAbsorbedDoseRateUnit("μGy/h (n)", 1.0, 10.0);
+    registerAbsorbedDoseRateUnit("μGy/h (α)", 1.0, 20.0);
+
+    // Tubo Geiger SBM-20 típico; otros tubos se registran con su calibración
+    registerCountRateUnit("CPM", 153.8, 0.0);
+
+    // Dosis integradas
+    int microSieverts = registerUnit({ "μSv", "Sv", UnitQuantity::DOSE, 1.0, 0.0, 1 });
+    int milliSieverts = registerUnit({ "mSv", "Sv", UnitQuantity::DOSE, 1000.0, 0.0, 3 });
+    int sieverts = registerUnit({ "Sv", "Sv", UnitQuantity::DOSE, 1000000.0, 0.0, 6 });
+    int milliRem = registerUnit({ "mrem", "rem", UnitQuantity::DOSE, 10.0, 0.0, 3 });
+    int rem = registerUnit({ "rem", "rem", UnitQuantity::DOSE, 10000.0, 0.0, 6 });
+    int bananas = registerUnit({ "BED", "BED", UnitQuantity::DOSE, ReferenceCatalog::BANANA_EQUIVALENT_DOSE, 0.0, 1 });
+
+    // Mismos cortes que getAutoFormattedValue: mSv a partir de 1000 μSv y Sv a partir de 10^6
+    addDisplayRule("Sv/h", 0.0, getUnitId(RadiationUnit::MICROSIEVERTS_PER_HOUR));
+    addDisplayRule("Sv/h", 1000.0, getUnitId(RadiationUnit::MILLISIEVERTS_PER_HOUR));
+    addDisplayRule("Sv/h", 1000000.0, getUnitId(RadiationUnit::SIEVERTS_PER_HOUR));
+    addDisplayRule("rem/h", 0.0, microRemPerHour);
+    addDisplayRule("rem/h", 10.0, milliRemPerHour);
+    addDisplayRule("rem/h", 10000.0, remPerHour);
+    addDisplayRule("Sv", 0.0, microSieverts);
+    addDisplayRule("Sv", 1000.0, milliSieverts);
+    addDisplayRule("Sv", 1000000.0, sieverts);
+    addDisplayRule("rem", 0.0, milliRem);
+    addDisplayRule("rem", 10000.0, rem);
+    addDisplayRule("BED", 0.0, bananas);
+}
+
+UnitRegistry& UnitRegistry::getDefault() {
+    // La estática se inicializa una sola vez aunque la pidan varios hilos,
+    // y el registro ya está congelado cuando alguien puede leerlo
+    static UnitRegistry registry = makeDefaultRegistry();
+    return registry;
+}
+
+int UnitRegistry::getUnitId(RadiationUnit unit) {
+    // Solo las tres primeras entradas corresponden a RadiationUnit
+    int index = static_cast<int>(unit);
+    return index >= 0 && index < 3 ? index : -1;
+}
+
+int UnitRegistry::registerUnit(const UnitDefinition& definition) {
+    if (frozen) return -1;
+    if (definition.symbol.empty() || !(definition.microSievertsPerUnit > 0.0) ||
+        !std::isfinite(definition.zeroPoint)) {
+        return -1;
+    }
+    if (findUnit(definition.symbol) >= 0) {
+        return -1;
+    }
+
+    UnitDefinition unit = definition;
+    unit.displayPrecision = std::max(0, std::min(unit.displayPrecision, 12));
+    units.push_back(unit);
+
+    // El último elemento de las tablas SoA es un centinela NaN para
+    // identificadores fuera de rango en convertMixedColumn
+    if (!scales.empty()) {
+        scales.pop_back();
+        zeroPoints.pop_back();
+    }
+    scales.push_back(unit.microSievertsPerUnit);
+    zeroPoints.push_back(unit.zeroPoint);
+    scales.push_back(std::numeric_limits<double>::quiet_NaN());
+    zeroPoints.push_back(0.0);
+    return static_cast<int>(units.size()) - 1;
+}
+
+int UnitRegistry::registerAbsorbedDoseRateUnit(const std::string& symbol, double microGrayPerUnit,
+                                               double radiationWeightingFactor) {
+    // H = w_R · D: 1 μGy de fotones equivale a 1 μSv
+    return registerUnit({ symbol, "", UnitQuantity::DOSE_RATE,
+                          microGrayPerUnit * radiationWeightingFactor, 0.0, 3 });
+}
+
+int UnitRegistry::registerCountRateUnit(const std::string& symbol, double cpmPerMicroSievert,
+                                        double backgroundCpm) {
+    if (!(cpmPerMicroSievert > 0.0)) return -1;
+    return registerUnit({ symbol, "", UnitQuantity::DOSE_RATE, 1.0 / cpmPerMicroSievert, backgroundCpm, 0 });
+}
+
+void UnitRegistry::freeze() {
+    frozen = true;
+}
+
+bool UnitRegistry::isFrozen() {
+    return frozen;
+}
+
+int UnitRegistry::findUnit(const std::string& symbol) {
+    for (size_t i = 0; i < units.size(); ++i) {
+        if (units[i].symbol == symbol) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+const UnitDefinition& UnitRegistry::getUnit(int unitId) {
+    return units[unitId];
+}
+
+size_t UnitRegistry::getUnitCount() {
+    return units.size();
+}
+
+bool UnitRegistry::isValidUnit(int unitId) {
+    return unitId >= 0 && unitId < static_cast<int>(units.size());
+}
+
+double UnitRegistry::toMicroSieverts(double value, int unitId) {
+    // 0.0 para una unidad desconocida, como el default del switch original
+    // de RadiationCalculator::convertToMicroSieverts; las rutas por
+    // columnas devuelven NaN para que el error no pase desapercibido
+    if (!isValidUnit(unitId)) return 0.0;
+    return (value - zeroPoints[unitId]) * scales[unitId];
+}
+
+double UnitRegistry::fromMicroSieverts(double microSieverts, int unitId) {
+    if (!isValidUnit(unitId)) return 0.0;
+    double value = microSieverts / scales[unitId];
+    return zeroPoints[unitId] != 0.0 ? value + zeroPoints[unitId] : value;
+}
+
+std::string UnitRegistry::format(double microSieverts, int unitId) {
+    if (!isValidUnit(unitId)) return "";
+
+    const UnitDefinition& unit = units[unitId];
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(unit.displayPrecision)
+        << fromMicroSieverts(microSieverts, unitId) << " " << unit.symbol;
+    return oss.str();
+}
+
+bool UnitRegistry::isValidValue(double value, int unitId) {
+    if (value < 0) return false;
+    return toMicroSieverts(value, unitId) <= MAX_MICROSIEVERTS;
+}
+
+void UnitRegistry::addDisplayRule(const std::string& family, double minMicroSieverts, int unitId) {
+    if (frozen || !isValidUnit(unitId)) return;
+
+    std::vector<std::pair<double, int>>& rules = displayRules[family];
+    rules.push_back({ minMicroSieverts, unitId });
+    std::sort(rules.begin(), rules.end(), [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+        return a.first > b.first;
+    });
+}
+
+std::string UnitRegistry::formatAuto(double microSieverts, const std::string& family) {
+    auto it = displayRules.find(family);
+    if (it == displayRules.end() || it->second.empty()) {
+        return format(microSieverts, 0);
+    }
+
+    const std::vector<std::pair<double, int>>& rules = it->second;
+    for (const std::pair<double, int>& rule : rules) {
+        if (microSieverts >= rule.first) {
+            return format(microSieverts, rule.second);
+        }
+    }
+    return format(microSieverts, rules.back().second);
+}
+
+void UnitRegistry::convertColumn(int unitId, const double* values, size_t count, double* outMicroSieverts) {
+    // Mismo criterio que el centinela de convertMixedColumn
+    double scale = isValidUnit(unitId) ? scales[unitId] : std::numeric_limits<double>::quiet_NaN();
+    double zeroPoint = isValidUnit(unitId) ? zeroPoints[unitId] : 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        outMicroSieverts[i] = (values[i] - zeroPoint) * scale;
+    }
+}
+
+void UnitRegistry::convertMixedColumn(const uint16_t* unitIds, const double* values, size_t count,
+                                      double* outMicroSieverts) {
+    // Acceso indexado a tablas pequeñas: con AVX2 o SVE se convierte en gather
+    const double* scaleTable = scales.data();
+    const double* zeroTable = zeroPoints.data();
+    uint32_t sentinel = static_cast<uint32_t>(units.size());
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t id = unitIds[i];
+        id = id < sentinel ? id : sentinel;
+        outMicroSieverts[i] = (values[i] - zeroTable[id]) * scaleTable[id];
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef UNITREGISTRY_H
+#define UNITREGISTRY_H
+
+#include "RadiationCalculator.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class UnitQuantity {
+    DOSE_RATE,   // Se convierte a μSv/h
+    DOSE         // Dosis integrada, se convierte a μSv
+};
+
+struct UnitDefinition {
+    std::string symbol;           // "mrem/h", "μGy/h (α)", "CPM"...
+    std::string family;           // Grupo de escalado automático ("Sv/h", "rem/h", "Sv"...)
+    UnitQuantity quantity;
+    double microSievertsPerUnit;  // μSv = (valor - zeroPoint) · microSievertsPerUnit
+    double zeroPoint;             // Desplazamiento en la unidad propia (fondo en CPM)
+    int displayPrecision;         // Decimales al formatear
+};
+
+// Registro de unidades con factores de conversión en tabla. Las tres
+// primeras entradas son las de RadiationUnit, en el mismo orden, así que
+// RadiationCalculator convierte y formatea a través de este registro.
+// Las unidades se registran al arrancar; después el registro es de solo
+// lectura y puede consultarse desde varios hilos. El registro por defecto
+// se congela al crearse: las unidades propias van en una instancia aparte.
+class UnitRegistry {
+public:
+    static constexpr double MAX_MICROSIEVERTS = 1000000000.0;  // Límite máximo práctico
+
+    UnitRegistry();
+
+    // Registro compartido por toda la aplicación
+    static UnitRegistry& getDefault();
+    static int getUnitId(RadiationUnit unit);
+
+    // Alta de unidades; devuelven el identificador o -1 si no es válida
+    // o el registro está congelado
+    int registerUnit(const UnitDefinition& definition);
+    int registerAbsorbedDoseRateUnit(const std::string& symbol, double microGrayPerUnit,
+                                     double radiationWeightingFactor);
+    int registerCountRateUnit(const std::string& symbol, double cpmPerMicroSievert, double backgroundCpm);
+
+    // Tras congelar no se admiten más unidades ni reglas de formato
+    void freeze();
+    bool isFrozen();
+
+    int findUnit(const std::string& symbol);
+    const UnitDefinition& getUnit(int unitId);
+    size_t getUnitCount();
+    bool isValidUnit(int unitId);
+
+    // Conversión y formato de un valor
+    double toMicroSieverts(double value, int unitId);
+    double fromMicroSieverts(double microSieverts, int unitId);
+    std::string format(double microSieverts, int unitId);
+    bool isValidValue(double value, int unitId);   // No negativo y <= MAX_MICROSIEVERTS
+
+    // Escalado automático: la primera regla cuyo mínimo se alcanza, de
+    // mayor a menor; si ninguna, la de menor mínimo
+    void addDisplayRule(const std::string& family, double minMicroSieverts, int unitId);
+    std::string formatAuto(double microSieverts, const std::string& family);
+
+    // Conversión de columnas completas a μSv(/h) en una pasada vectorizable;
+    // una unidad desconocida produce NaN
+    void convertColumn(int unitId, const double* values, size_t count, double* outMicroSieverts);
+    void convertMixedColumn(const uint16_t* unitIds, const double* values, size_t count,
+                            double* outMicroSieverts);
+
+private:
+    std::vector<UnitDefinition> units;
+    bool frozen;
+    std::map<std::string, std::vector<std::pair<double, int>>> displayRules;
+
+    // Factores en formato SoA para las conversiones por lotes
+    std::vector<double> scales;
+    std::vector<double> zeroPoints;
+};
+
+#endif // UNITREGISTRY_H
@@ -0,0 +1,76 @@
+#include "WelcomeOverlay.h"
+#include "FalloutStyleWidget.h"
+#include <QEvent>
+#include <QPainter>
+#include <QTimer>
+#include <QVBoxLayout>
+
+WelcomeOverlay::WelcomeOverlay(const QString& message, QWidget* parent)
+    : QWidget(parent) {
+    setAttribute(Qt::WA_DeleteOnClose);
+    setFocusPolicy(Qt::StrongFocus);
+
+    messageLabel = new FalloutLabel(message, this);
+    messageLabel->setAlignment(Qt::AlignCenter);
+    messageLabel->setWordWrap(true);
+    messageLabel->setGlowEffect(true);
+
+    QVBoxLayout* layout = new QVBoxLayout(this);
+    layout->addStretch();
+    layout->addWidget(messageLabel, 0, Qt::AlignCenter);
+    layout->addStretch();
+
+    dismissTimer = new QTimer(this);
+    dismissTimer->setSingleShot(true);
+    connect(dismissTimer, &QTimer::timeout, this, &WelcomeOverlay::dismiss);
+
+    // Sigue el tamaño de la ventana sobre la que se superpone
+    if (parent) {
+        parent->installEventFilter(this);
+        setGeometry(parent->rect());
+    }
+}
+
+void WelcomeOverlay::showFor(int milliseconds) {
+    raise();
+    show();
+    setFocus();
+    if (milliseconds > 0) {
+        dismissTimer->start(milliseconds);
+    }
+}
+
+bool WelcomeOverlay::eventFilter(QObject* watched, QEvent* event) {
+    if (watched == parentWidget() && event->type() == QEvent::Resize) {
+        setGeometry(parentWidget()->rect());
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+void WelcomeOverlay::mousePressEvent(QMouseEvent* event) {
+    Q_UNUSED(event);
+    dismiss();
+}
+
+void WelcomeOverlay::keyPressEvent(QKeyEvent* event) {
+    Q_UNUSED(event);
+    dismiss();
+}
+
+void WelcomeOverlay::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event);
+
+    // Fondo semitransparente con marco de terminal
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(0, 0, 0, 200));
+    painter.setPen(QPen(QColor(FalloutStyleWidget::FALLOUT_GREEN), 2));
+    painter.drawRect(rect().adjusted(1, 1, -2, -2));
+}
+
+void WelcomeOverlay::dismiss() {
+    dismissTimer->stop();
+    if (parentWidget()) {
+        parentWidget()->removeEventFilter(this);
+    }
+    close();
+}
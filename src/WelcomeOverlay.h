@@ -0,0 +1,36 @@
+#ifndef WELCOMEOVERLAY_H
+#define WELCOMEOVERLAY_H
+
+#include <QWidget>
+
+class QTimer;
+class FalloutLabel;
+
+// Mensaje de bienvenida superpuesto a la ventana principal. A diferencia
+// del QMessageBox modal no bloquea el bucle de eventos: la ventana se
+// pinta y responde desde el primer frame, y el aviso se cierra con un
+// clic, una tecla o al agotarse el tiempo. Sin padre se muestra como
+// ventana propia con el tamaño por defecto.
+class WelcomeOverlay : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit WelcomeOverlay(const QString& message, QWidget* parent);
+
+    void showFor(int milliseconds);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
+
+private slots:
+    void dismiss();
+
+private:
+    FalloutLabel* messageLabel;
+    QTimer* dismissTimer;
+};
+
+#endif // WELCOMEOVERLAY_H
@@ -1,12 +1,29 @@
 #include <QApplication>
 #include <QStyleFactory>
-#include <QDir>
-#include <QStandardPaths>
 #include <QMessageBox>
 #include "MainWindow.h"
+#include "FalloutStyleWidget.h"
+#include "StartupProfiler.h"
+#include "WelcomeOverlay.h"
+
+namespace {
+    const int WELCOME_OVERLAY_MS = 8000;
+
+    // Texto de la superposición de bienvenida
+    const char WELCOME_MESSAGE[] =
+        "☢️ SISTEMA INICIADO ☢️\n\n"
+        "Medidor de Radiación v2.287\n"
+        "Estado: OPERATIVO\n\n"
+        "Ingrese un nivel de radiación para comenzar el análisis.\n"
+        "¡Manténgase seguro ahí fuera, habitante del Refugio!";
+}
 
 int main(int argc, char *argv[]) {
+    StartupProfiler& profiler = StartupProfiler::instance();
+    profiler.start();
+    
     QApplication app(argc, argv);
+    profiler.markPhase("QApplication");
     
     // Set application properties
     app.setApplicationName("Radiation Monitor");
@@ -35,26 +52,21 @@ int main(int argc, char *argv[]) {
     darkPalette.setColor(QPalette::HighlightedText, QColor(0, 0, 0));
     app.setPalette(darkPalette);
     
-    // Check if resources directory exists
-    QDir resourcesDir("resources");
-    if (!resourcesDir.exists()) {
-        QMessageBox::warning(nullptr, "Recursos Faltantes", 
-            "No se encontró el directorio 'resources'. "
-            "Asegúrese de que el programa esté en el directorio correcto.");
-    }
+    // Hoja de estilo Fallout analizada una sola vez para toda la aplicación
+    FalloutStyleWidget::installApplicationStyle(&app);
+    profiler.markPhase("Estilo y paleta");
     
     try {
         MainWindow window;
+        profiler.markPhase("Construcción de MainWindow");
+        
+        profiler.watchFirstFrame(&window);
         window.show();
+        profiler.markPhase("Mostrar ventana");
         
-        // Show welcome message
-        QMessageBox::information(&window, 
-            "Bienvenido", 
-            "☢️ SISTEMA INICIADO ☢️\n\n"
-            "Medidor de Radiación v2.287\n"
-            "Estado: OPERATIVO\n\n"
-            "Ingrese un nivel de radiación para comenzar el análisis.\n"
-            "¡Manténgase seguro ahí fuera, habitante del Refugio!");
+        // Bienvenida no modal: no retrasa el primer frame
+        WelcomeOverlay* welcome = new WelcomeOverlay(QString::fromUtf8(WELCOME_MESSAGE), &window);
+        welcome->showFor(WELCOME_OVERLAY_MS);
         
         return app.exec();
         
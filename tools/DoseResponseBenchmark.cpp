@@ -0,0 +1,133 @@
+// Benchmark y verificación del modelo continuo dosis-respuesta.
+//
+// Uso: DoseResponseBenchmark [--count N] [--repeat R]
+//
+// Compara el evaluador por lotes (aproximaciones rápidas) con la referencia
+// escalar de <cmath> y con la tabla escalonada de HealthEffectAnalyzer.
+// El error se mide con los parámetros por defecto y con un barrido de
+// LD50 y pendiente en las formas PROBIT y LOGISTIC.
+// Devuelve 1 si el error supera DoseResponseModel::MAX_BATCH_ERROR o si el
+// lote no es más rápido que la referencia escalar. La ventaja del lote
+// depende de que el compilador lo vectorice: con GCC, -O3 -fno-trapping-math.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "DoseResponseModel.h"
+#include "HealthEffectAnalyzer.h"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    template <typename Fn>
+    double bestOfMs(int repeat, Fn fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeat; ++r) {
+            Clock::time_point start = Clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 1000000;
+    int repeat = 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--count") == 0) count = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--repeat") == 0) repeat = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    // Dosis log-uniformes entre 10 μSv y 100 Sv, más los bordes de la tabla
+    // y valores no finitos
+    std::vector<double> doses(count);
+    for (size_t i = 0; i < count; ++i) {
+        doses[i] = std::pow(10.0, 1.0 + 7.0 * static_cast<double>(i) / count);
+    }
+    const double edges[] = { 0.0, 1e6, 2e6, 4e6, 6e6, 1e7, std::nan(""), HUGE_VAL };
+    for (size_t i = 0; i < 8 && i < count; ++i) {
+        doses[i] = edges[i];
+    }
+
+    DoseResponseModel model;
+    HealthEffectAnalyzer analyzer;
+    std::vector<double> out(count);
+    volatile double sink = 0.0;
+
+    double batchMs = bestOfMs(repeat, [&]() {
+        model.getSurvivalProbabilityBatch(doses.data(), count, false, out.data());
+        sink = sink + out[count / 2];
+    });
+    double scalarMs = bestOfMs(repeat, [&]() {
+        for (size_t i = 0; i < count; ++i) out[i] = model.getSurvivalProbability(doses[i], false);
+        sink = sink + out[count / 2];
+    });
+    double stepMs = bestOfMs(repeat, [&]() {
+        for (size_t i = 0; i < count; ++i) out[i] = analyzer.getSurvivalProbability(doses[i], false);
+        sink = sink + out[count / 2];
+    });
+
+    double errorUntreated = model.measureBatchError(doses, false);
+    double errorTreated = model.measureBatchError(doses, true);
+
+    // Barrido de parámetros en ambas formas sobre un modelo aparte
+    const DoseResponseForm forms[] = { DoseResponseForm::PROBIT, DoseResponseForm::LOGISTIC };
+    const double ld50s[] = { 1.0, 3.0, 5.0, 8.0 };
+    const double slopes[] = { 0.5, 1.0, 2.2, 4.0, 8.0 };
+    double errorProbitSweep = 0.0;
+    double errorLogisticSweep = 0.0;
+    DoseResponseModel sweepModel;
+    for (DoseResponseForm form : forms) {
+        double& sweepError = form == DoseResponseForm::PROBIT ? errorProbitSweep : errorLogisticSweep;
+        for (double ld50 : ld50s) {
+            for (double slope : slopes) {
+                sweepModel.setParameters(false, { form, ld50, slope, 98.0, 1.0 });
+                double error = sweepModel.measureBatchError(doses, false);
+                if (!(error <= sweepError)) sweepError = error;
+            }
+        }
+    }
+
+    // Verificación de las aproximaciones individuales
+    double expError = 0.0;
+    double logError = 0.0;
+    double erfError = 0.0;
+    for (int i = -2000; i <= 2000; ++i) {
+        double x = i * 0.01;
+        expError = std::max(expError, std::fabs(DoseResponseModel::fastExp(x) / std::exp(x) - 1.0));
+        erfError = std::max(erfError, std::fabs(DoseResponseModel::fastErf(x * 0.25) - std::erf(x * 0.25)));
+        double y = std::pow(10.0, x * 0.1);
+        logError = std::max(logError, std::fabs(DoseResponseModel::fastLog(y) - std::log(y)));
+    }
+
+    bool withinBounds = errorUntreated <= DoseResponseModel::MAX_BATCH_ERROR &&
+                        errorTreated <= DoseResponseModel::MAX_BATCH_ERROR &&
+                        errorProbitSweep <= DoseResponseModel::MAX_BATCH_ERROR &&
+                        errorLogisticSweep <= DoseResponseModel::MAX_BATCH_ERROR;
+    bool batchFaster = batchMs < scalarMs;
+
+    std::printf("{\n");
+    std::printf("  \"count\": %zu,\n", count);
+    std::printf("  \"batch_ms\": %.3f,\n", batchMs);
+    std::printf("  \"scalar_reference_ms\": %.3f,\n", scalarMs);
+    std::printf("  \"step_table_ms\": %.3f,\n", stepMs);
+    std::printf("  \"batch_ns_per_dose\": %.3f,\n", batchMs * 1e6 / count);
+    std::printf("  \"max_error_untreated\": %.3e,\n", errorUntreated);
+    std::printf("  \"max_error_treated\": %.3e,\n", errorTreated);
+    std::printf("  \"max_error_probit_sweep\": %.3e,\n", errorProbitSweep);
+    std::printf("  \"max_error_logistic_sweep\": %.3e,\n", errorLogisticSweep);
+    std::printf("  \"error_bound\": %.3e,\n", DoseResponseModel::MAX_BATCH_ERROR);
+    std::printf("  \"fast_exp_max_rel_error\": %.3e,\n", expError);
+    std::printf("  \"fast_log_max_abs_error\": %.3e,\n", logError);
+    std::printf("  \"fast_erf_max_abs_error\": %.3e,\n", erfError);
+    std::printf("  \"within_bounds\": %s,\n", withinBounds ? "true" : "false");
+    std::printf("  \"batch_faster\": %s\n", batchFaster ? "true" : "false");
+    std::printf("}\n");
+
+    return withinBounds && batchFaster ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+// Generador de carga para RadiationDaemon.
+//
+// Uso: LoadGenerator [--unix /ruta/socket] [--host 127.0.0.1] [--port 7287]
+//                    [--rate 100000] [--duration 10] [--connections 4]
+//                    [--op level|safe_exposure|analyze|report]
+//
+// Envía peticiones binarias en bucle abierto al ritmo indicado, repartidas
+// entre varias conexiones, y mide la latencia extremo a extremo (p50/p99).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "QueryProtocol.h"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    struct LoadConfig {
+        std::string unixSocketPath;
+        std::string host = "127.0.0.1";
+        uint16_t port = 7287;
+        double rate = 100000.0;
+        double durationSeconds = 10.0;
+        int connections = 4;
+        QueryOperation operation = QueryOperation::DANGER_LEVEL;
+    };
+
+    struct ConnectionStats {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+        std::vector<int64_t> latenciesNs;
+    };
+
+    int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    int connectToServer(const LoadConfig& config) {
+        int fd = -1;
+        if (!config.unixSocketPath.empty()) {
+            sockaddr_un address;
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, config.unixSocketPath.c_str(), sizeof(address.sun_path) - 1);
+            fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+                ::close(fd);
+                return -1;
+            }
+        } else {
+            sockaddr_in address;
+            std::memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_port = htons(config.port);
+            ::inet_pton(AF_INET, config.host.c_str(), &address.sin_addr);
+            fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+                ::close(fd);
+                return -1;
+            }
+            int noDelay = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        }
+
+        timeval timeout = { 2, 0 };
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        return fd;
+    }
+
+    bool sendAll(int fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t written = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (written <= 0) return false;
+            sent += static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    void runConnection(const LoadConfig& config, int fd, uint64_t total, double ratePerConnection,
+                       ConnectionStats& stats) {
+        std::unique_ptr<std::atomic<int64_t>[]> sendTimes(new std::atomic<int64_t>[total]);
+        std::atomic<bool> senderDone(false);
+        stats.latenciesNs.reserve(total);
+
+        std::thread receiver([&]() {
+            std::string buffer;
+            char chunk[64 * 1024];
+            while (stats.received < total) {
+                ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+                if (received <= 0) {
+                    if (senderDone.load()) break;  // Tiempo agotado tras terminar el envío
+                    continue;
+                }
+                buffer.append(chunk, static_cast<size_t>(received));
+
+                size_t offset = 0;
+                int64_t now = nowNs();
+                while (buffer.size() - offset >= QueryProtocol::FRAME_HEADER_SIZE) {
+                    uint32_t length = QueryProtocol::readU32(buffer.data() + offset);
+                    if (buffer.size() - offset < QueryProtocol::FRAME_HEADER_SIZE + length) break;
+
+                    uint32_t id = QueryProtocol::readU32(buffer.data() + offset + QueryProtocol::FRAME_HEADER_SIZE + 1);
+                    if (id < total) {
+                        stats.latenciesNs.push_back(now - sendTimes[id].load(std::memory_order_acquire));
+                    }
+                    ++stats.received;
+                    offset += QueryProtocol::FRAME_HEADER_SIZE + length;
+                }
+                buffer.erase(0, offset);
+            }
+        });
+
+        // Bucle abierto: en cada vuelta se envían todas las peticiones que ya tocan
+        std::string batch;
+        int64_t start = nowNs();
+        uint64_t next = 0;
+        while (next < total) {
+            int64_t elapsed = nowNs() - start;
+            uint64_t due = std::min<uint64_t>(total, static_cast<uint64_t>(elapsed * 1e-9 * ratePerConnection) + 1);
+            if (due <= next) {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                continue;
+            }
+
+            batch.clear();
+            int64_t stamp = nowNs();
+            for (; next < due; ++next) {
+                QueryRequest request = { config.operation, static_cast<uint32_t>(next),
+                                         0.05 * static_cast<double>(next % 40000), 1.0 };
+                sendTimes[next].store(stamp, std::memory_order_release);
+                QueryProtocol::encodeRequest(request, batch);
+            }
+            if (!sendAll(fd, batch)) break;
+            stats.sent = next;
+        }
+
+        senderDone.store(true);
+        receiver.join();
+    }
+
+    double percentile(const std::vector<int64_t>& sorted, double q) {
+        if (sorted.empty()) return 0.0;
+        size_t index = std::min(sorted.size() - 1, static_cast<size_t>(q * sorted.size()));
+        return sorted[index] / 1000.0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    LoadConfig config;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--unix") == 0) config.unixSocketPath = argv[i + 1];
+        else if (std::strcmp(argv[i], "--host") == 0) config.host = argv[i + 1];
+        else if (std::strcmp(argv[i], "--port") == 0) config.port = static_cast<uint16_t>(std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--rate") == 0) config.rate = std::max(1.0, std::atof(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--duration") == 0) config.durationSeconds = std::max(0.1, std::atof(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--connections") == 0) config.connections = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--op") == 0) {
+            std::string op = argv[i + 1];
+            if (op == "safe_exposure") config.operation = QueryOperation::SAFE_EXPOSURE;
+            else if (op == "analyze") config.operation = QueryOperation::ANALYZE;
+            else if (op == "report") config.operation = QueryOperation::REPORT;
+            else config.operation = QueryOperation::DANGER_LEVEL;
+        }
+    }
+
+    double ratePerConnection = config.rate / config.connections;
+    uint64_t perConnection = static_cast<uint64_t>(ratePerConnection * config.durationSeconds);
+
+    std::vector<int> sockets;
+    for (int i = 0; i < config.connections; ++i) {
+        int fd = connectToServer(config);
+        if (fd < 0) {
+            std::fprintf(stderr, "No se pudo conectar con el servicio\n");
+            return 1;
+        }
+        sockets.push_back(fd);
+    }
+
+    std::vector<ConnectionStats> stats(config.connections);
+    std::vector<std::thread> workers;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < config.connections; ++i) {
+        workers.emplace_back(runConnection, std::cref(config), sockets[i], perConnection,
+                             ratePerConnection, std::ref(stats[i]));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<int64_t> latencies;
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    for (auto& s : stats) {
+        sent += s.sent;
+        received += s.received;
+        latencies.insert(latencies.end(), s.latenciesNs.begin(), s.latenciesNs.end());
+    }
+    for (int fd : sockets) {
+        ::close(fd);
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::printf("{\n");
+    std::printf("  \"operation\": \"%s\",\n", QueryProtocol::operationName(config.operation));
+    std::printf("  \"target_rate\": %.0f,\n", config.rate);
+    std::printf("  \"achieved_rate\": %.0f,\n", elapsed > 0.0 ? received / elapsed : 0.0);
+    std::printf("  \"sent\": %llu,\n", static_cast<unsigned long long>(sent));
+    std::printf("  \"received\": %llu,\n", static_cast<unsigned long long>(received));
+    std::printf("  \"p50_us\": %.1f,\n", percentile(latencies, 0.50));
+    std::printf("  \"p99_us\": %.1f,\n", percentile(latencies, 0.99));
+    std::printf("  \"max_us\": %.1f\n", latencies.empty() ? 0.0 : latencies.back() / 1000.0);
+    std::printf("}\n");
+
+    return received == sent ? 0 : 2;
+}
@@ -0,0 +1,92 @@
+// Benchmark y verificación de las políticas de precisión.
+//
+// Uso: PrecisionBenchmark [--count N] [--repeat R]
+//
+// Comprueba que float y punto fijo en nSv dan el mismo DangerLevel que
+// double en los valores frontera y mide la clasificación y el indicador
+// por lotes en cada precisión. Devuelve 1 si algún nivel no coincide.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "PrecisionPolicy.h"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    template <typename Fn>
+    double bestOfMs(int repeat, Fn fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeat; ++r) {
+            Clock::time_point start = Clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    }
+
+    template <typename Policy>
+    void measure(const char* label, const std::vector<double>& readings, int repeat, bool last) {
+        size_t count = readings.size();
+        std::vector<typename Policy::Value> values(count);
+        convertFromMicroSieverts<Policy>(readings.data(), count, values.data());
+        std::vector<DangerLevel> levels(count);
+        std::vector<int> gauge(count);
+        volatile int sink = 0;
+
+        double classifyMs = bestOfMs(repeat, [&]() {
+            classifyKernel<Policy>(values.data(), count, levels.data());
+            sink = sink + static_cast<int>(levels[count / 2]);
+        });
+        double gaugeMs = bestOfMs(repeat, [&]() {
+            gaugeKernel<Policy>(values.data(), count, gauge.data());
+            sink = sink + gauge[count / 2];
+        });
+
+        std::printf("    \"%s\": { \"value_bytes\": %zu, \"classify_ms\": %.3f, \"classify_ns_per_value\": %.3f, "
+                    "\"gauge_ms\": %.3f, \"gauge_ns_per_value\": %.3f }%s\n",
+                    label, sizeof(typename Policy::Value), classifyMs, classifyMs * 1e6 / count,
+                    gaugeMs, gaugeMs * 1e6 / count, last ? "" : ",");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 4000000;
+    int repeat = 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--count") == 0) count = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--repeat") == 0) repeat = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    // Lecturas log-uniformes entre 0.01 μSv/h y 100 Sv/h
+    std::vector<double> readings(count);
+    for (size_t i = 0; i < count; ++i) {
+        readings[i] = std::pow(10.0, -2.0 + 10.0 * static_cast<double>((i * 7919) % count) / count);
+    }
+
+    PrecisionAgreementReport agreement = verifyPrecisionAgreement();
+    bool agrees = agreement.doubleLevelMismatches == 0 &&
+                  agreement.floatLevelMismatches == 0 &&
+                  agreement.fixedLevelMismatches == 0;
+
+    std::printf("{\n");
+    std::printf("  \"count\": %zu,\n", count);
+    std::printf("  \"kernels\": {\n");
+    measure<DoublePrecision>(DoublePrecision::name(), readings, repeat, false);
+    measure<FloatPrecision>(FloatPrecision::name(), readings, repeat, false);
+    measure<FixedPointPrecision>(FixedPointPrecision::name(), readings, repeat, true);
+    std::printf("  },\n");
+    std::printf("  \"boundary_values_checked\": %zu,\n", agreement.valuesChecked);
+    std::printf("  \"level_mismatches\": { \"double\": %zu, \"float\": %zu, \"fixed_nsv\": %zu },\n",
+                agreement.doubleLevelMismatches, agreement.floatLevelMismatches, agreement.fixedLevelMismatches);
+    std::printf("  \"max_gauge_delta\": { \"double\": %d, \"float\": %d, \"fixed_nsv\": %d },\n",
+                agreement.maxDoubleGaugeDelta, agreement.maxFloatGaugeDelta, agreement.maxFixedGaugeDelta);
+    std::printf("  \"levels_agree\": %s\n", agrees ? "true" : "false");
+    std::printf("}\n");
+
+    return agrees ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// Benchmark y verificación del procesado por lotes de cuentas de pulsos.
+//
+// Uso: PulseBatchBenchmark [--count N] [--repeat R] [--min-per-ms M]
+//
+// Procesa N intervalos con detectores todos no paralizables, mitad y mitad
+// y todos paralizables. Compara la corrección paralizable con una
+// referencia por bisección en long double y comprueba que processBatch y
+// rateToMicroSieverts coinciden. Devuelve 1 si el error relativo supera
+// 1e-12 o si algún caso procesa menos de M intervalos por milisegundo
+// (por defecto 100000). El objetivo supone el bucle vectorizado: -O3
+// -fno-trapping-math y AVX2 (por ejemplo -march=x86-64-v3); sin AVX2 o
+// con -O2 conviene bajar M con --min-per-ms.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "PulseCountProcessor.h"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const double MAX_RELATIVE_ERROR = 1e-12;
+
+    template <typename Fn>
+    double bestOfMs(int repeat, Fn fn) {
+        double best = 1e300;
+        for (int r = 0; r < repeat; ++r) {
+            Clock::time_point start = Clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    }
+
+    // Raíz de la rama baja de m = n·e^(-n·τ) por bisección en [m, 1/τ]
+    long double referenceParalyzable(long double measured, long double tau) {
+        if (measured <= 0.0L || tau <= 0.0L) return measured > 0.0L ? measured : 0.0L;
+        if (measured * tau >= expl(-1.0L)) return 1.0L / tau;
+        long double low = measured;
+        long double high = 1.0L / tau;
+        for (int i = 0; i < 200; ++i) {
+            long double mid = 0.5L * (low + high);
+            if (mid * expl(-mid * tau) < measured) low = mid; else high = mid;
+        }
+        return 0.5L * (low + high);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 100000;
+    int repeat = 20;
+    double minPerMs = 100000.0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--count") == 0) count = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--repeat") == 0) repeat = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--min-per-ms") == 0) minPerMs = std::atof(argv[i + 1]);
+    }
+
+    // SBM-20 típico con los dos modelos de tiempo muerto; las cuentas
+    // recorren desde el fondo hasta más allá de la saturación
+    PulseCountProcessor processor;
+    uint32_t paralyzableDetector = static_cast<uint32_t>(processor.registerDetector(
+        { "SBM-20-P", 153.8, 190e-6, 20.0, DeadTimeModel::PARALYZABLE }));
+    uint32_t nonParalyzableDetector = static_cast<uint32_t>(processor.registerDetector(
+        { "SBM-20-N", 153.8, 190e-6, 20.0, DeadTimeModel::NON_PARALYZABLE }));
+
+    std::vector<double> counts(count);
+    std::vector<double> intervals(count, 1.0);
+    std::vector<uint32_t> detectors(count);
+    std::vector<double> out(count);
+    double saturationCps = std::exp(-1.0) / 190e-6;
+    for (size_t i = 0; i < count; ++i) {
+        counts[i] = std::pow(10.0, -1.0 + 5.0 * static_cast<double>((i * 7919) % count) / count);
+        counts[i] = std::min(counts[i], saturationCps * 1.2);
+    }
+
+    const char* labels[] = { "non_paralyzable", "mixed", "paralyzable" };
+    double perMs[3];
+    double ms[3];
+    for (int mix = 0; mix < 3; ++mix) {
+        for (size_t i = 0; i < count; ++i) {
+            bool paralyzable = mix == 2 || (mix == 1 && (i & 1));
+            detectors[i] = paralyzable ? paralyzableDetector : nonParalyzableDetector;
+        }
+        volatile double sink = 0.0;
+        ms[mix] = bestOfMs(repeat, [&]() {
+            processor.processBatch(detectors.data(), counts.data(), intervals.data(), count, out.data());
+            sink = sink + out[count / 2];
+        });
+        perMs[mix] = count / ms[mix];
+    }
+
+    // Precisión de la corrección paralizable en todo el rango de x = m·τ,
+    // incluido el entorno del punto de rama, y coincidencia lote/escalar
+    double tau = 190e-6;
+    double maxError = 0.0;
+    for (int i = 0; i <= 200000; ++i) {
+        double x = i % 2 ? std::exp(-1.0) * (1.0 - std::pow(10.0, -12.0 * i / 200000.0))
+                         : std::exp(-1.0) * std::pow(10.0, -12.0 * i / 200000.0);
+        double measured = x / tau;
+        long double reference = referenceParalyzable(measured, tau);
+        double corrected = processor.correctDeadTime(measured, static_cast<int>(paralyzableDetector));
+        // Error en la tasa medida reconstruida: bien condicionado también cerca de la saturación
+        long double rebuilt = corrected * expl(-static_cast<long double>(corrected) * tau);
+        double error = static_cast<double>(fabsl(rebuilt - measured) / measured);
+        if (reference * tau < 0.9L && corrected != 0.0) {
+            double direct = static_cast<double>(fabsl(corrected - reference) / reference);
+            error = std::max(error, direct);
+        }
+        if (!(error <= maxError)) maxError = error;
+    }
+
+    size_t batchMismatches = 0;
+    for (size_t i = 0; i < count; ++i) {
+        detectors[i] = i & 1 ? paralyzableDetector : nonParalyzableDetector;
+    }
+    processor.processBatch(detectors.data(), counts.data(), intervals.data(), count, out.data());
+    for (size_t i = 0; i < count; ++i) {
+        double scalar = processor.countsToMicroSieverts(counts[i], intervals[i], static_cast<int>(detectors[i]));
+        if (std::fabs(out[i] - scalar) > 1e-14 * std::max(1.0, std::fabs(scalar))) ++batchMismatches;
+    }
+
+    bool accurate = maxError <= MAX_RELATIVE_ERROR && batchMismatches == 0;
+    bool fastEnough = perMs[0] >= minPerMs && perMs[1] >= minPerMs && perMs[2] >= minPerMs;
+
+    std::printf("{\n");
+    std::printf("  \"count\": %zu,\n", count);
+    for (int mix = 0; mix < 3; ++mix) {
+        std::printf("  \"%s\": { \"ms\": %.3f, \"intervals_per_ms\": %.0f },\n", labels[mix], ms[mix], perMs[mix]);
+    }
+    std::printf("  \"min_intervals_per_ms\": %.0f,\n", minPerMs);
+    std::printf("  \"paralyzable_max_rel_error\": %.3e,\n", maxError);
+    std::printf("  \"batch_scalar_mismatches\": %zu,\n", batchMismatches);
+    std::printf("  \"accurate\": %s,\n", accurate ? "true" : "false");
+    std::printf("  \"fast_enough\": %s\n", fastEnough ? "true" : "false");
+    std::printf("}\n");
+
+    return accurate && fastEnough ? 0 : 1;
+}
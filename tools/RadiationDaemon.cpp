@@ -0,0 +1,56 @@
+// Servicio de consultas sin interfaz gráfica (Linux, epoll).
+//
+// Uso: RadiationDaemon [--unix /ruta/socket] [--host 127.0.0.1] [--port 7287]
+//
+// Expone getDangerLevel, getSafeExposureTime, analyzeEffects y el informe
+// formateado con el protocolo descrito en QueryProtocol.h.
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "QueryServer.h"
+
+namespace {
+    QueryServer* activeServer = nullptr;
+
+    void onSignal(int) {
+        if (activeServer) {
+            activeServer->stop();
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    QueryServerConfig config;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--unix") == 0) config.unixSocketPath = argv[i + 1];
+        else if (std::strcmp(argv[i], "--host") == 0) config.tcpAddress = argv[i + 1];
+        else if (std::strcmp(argv[i], "--port") == 0) config.tcpPort = static_cast<uint16_t>(std::atoi(argv[i + 1]));
+    }
+
+    QueryServer server;
+    if (!server.start(config)) {
+        std::fprintf(stderr, "Error al iniciar el servicio: %s\n", server.getLastError().c_str());
+        return 1;
+    }
+
+    activeServer = &server;
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (config.unixSocketPath.empty()) {
+        std::printf("Servicio de radiación escuchando en %s:%u\n", config.tcpAddress.c_str(), config.tcpPort);
+    } else {
+        std::printf("Servicio de radiación escuchando en %s\n", config.unixSocketPath.c_str());
+    }
+    std::fflush(stdout);
+
+    server.run();
+
+    std::printf("Peticiones atendidas: %llu\n", static_cast<unsigned long long>(server.getRequestsServed()));
+    activeServer = nullptr;
+    return 0;
+}
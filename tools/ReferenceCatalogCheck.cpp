@@ -0,0 +1,170 @@
+// Verificación del índice de ReferenceCatalog frente a una búsqueda exhaustiva.
+//
+// Uso: ReferenceCatalogCheck [--count N] [--k K]
+//
+// Amplía el catálogo base con referencias repartidas en escala logarítmica
+// y compara findNearest (con cada filtro de tipo) y annotateBatch con una
+// ordenación completa por distancia en log10 para N lecturas log-espaciadas
+// entre 1e-6 y 1e12 μSv/h. Como puede haber empates, se comparan las
+// distancias en orden y que cada índice sea único y del tipo pedido.
+// También comprueba que las lecturas NaN o negativas no tienen referencias
+// y que las tasas mal formadas o no finitas se rechazan. Devuelve 1 si
+// algo no coincide.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ReferenceCatalog.h"
+
+namespace {
+    // Mismo suelo que ReferenceCatalog para las lecturas nulas
+    double referenceLog10(double microSievertsPerHour) {
+        return std::log10(microSievertsPerHour > 1e-9 ? microSievertsPerHour : 1e-9);
+    }
+
+    // Distancias de las k referencias más cercanas por búsqueda exhaustiva
+    std::vector<double> bruteForceDistances(const std::vector<double>& logRates,
+                                            const std::vector<uint32_t>& kindBits,
+                                            double logRate, size_t k, uint32_t kindMask) {
+        std::vector<double> distances;
+        for (size_t i = 0; i < logRates.size(); ++i) {
+            if (kindMask & kindBits[i]) distances.push_back(std::fabs(logRate - logRates[i]));
+        }
+        std::sort(distances.begin(), distances.end());
+        distances.resize(std::min(k, distances.size()));
+        return distances;
+    }
+
+    bool sameMatches(ReferenceCatalog& catalog, const std::vector<double>& logRates,
+                     const std::vector<uint32_t>& kindBits, double reading, const ReferenceMatch* matches,
+                     size_t found, const std::vector<double>& expected, uint32_t kindMask) {
+        if (found != expected.size()) return false;
+        double logRate = referenceLog10(reading);
+        for (size_t j = 0; j < found; ++j) {
+            uint32_t index = matches[j].index;
+            if (index >= logRates.size() || !(kindMask & kindBits[index])) return false;
+            if (std::fabs(logRate - logRates[index]) != expected[j]) return false;
+            if (matches[j].ratio != reading / catalog.getReference(index).microSievertsPerHour) return false;
+            for (size_t other = 0; other < j; ++other) {
+                if (matches[other].index == index) return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 100000;
+    size_t k = 5;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--count") == 0) count = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--k") == 0) k = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    // Catálogo base más 600 referencias entre 1e-5 y 1e11 μSv/h, con
+    // duplicados para forzar empates
+    ReferenceCatalog catalog;
+    std::ostringstream extra;
+    const char* kinds[] = { "site", "source", "bed" };
+    for (int i = 0; i < 600; ++i) {
+        double rate = std::pow(10.0, -5.0 + 16.0 * ((i * 37) % 600) / 600.0);
+        extra << kinds[i % 3] << " " << rate << " Extra " << i << "\n";
+        if (i % 50 == 0) extra << kinds[(i + 1) % 3] << " " << rate << " Duplicado " << i << "\n";
+    }
+    bool loaded = catalog.loadFromString(extra.str()) > 0;
+
+    std::vector<double> logRates(catalog.getReferenceCount());
+    std::vector<uint32_t> kindBits(catalog.getReferenceCount());
+    for (uint32_t i = 0; i < catalog.getReferenceCount(); ++i) {
+        const ReferencePoint& reference = catalog.getReference(i);
+        logRates[i] = referenceLog10(reference.microSievertsPerHour);
+        kindBits[i] = 1u << static_cast<int>(reference.kind);
+    }
+
+    std::vector<double> readings(count);
+    for (size_t i = 0; i < count; ++i) {
+        readings[i] = std::pow(10.0, -6.0 + 18.0 * static_cast<double>(i) / count);
+    }
+
+    size_t nearestMismatches = 0;
+    size_t batchMismatches = 0;
+    const uint32_t masks[] = { ReferenceCatalog::ALL_KINDS, 0x1, 0x2, 0x4, 0x5 };
+    for (size_t i = 0; i < count; ++i) {
+        double logRate = referenceLog10(readings[i]);
+        for (uint32_t mask : masks) {
+            // El filtro por tipo se comprueba en una de cada diez lecturas
+            if (mask != ReferenceCatalog::ALL_KINDS && i % 10 != 0) continue;
+            std::vector<ReferenceMatch> matches = catalog.findNearest(readings[i], k, mask);
+            std::vector<double> expected = bruteForceDistances(logRates, kindBits, logRate, k, mask);
+            if (!sameMatches(catalog, logRates, kindBits, readings[i], matches.data(), matches.size(),
+                             expected, mask)) {
+                ++nearestMismatches;
+            }
+        }
+    }
+
+    std::vector<ReferenceMatch> batch(count * k);
+    catalog.annotateBatch(readings.data(), count, k, batch.data());
+    for (size_t i = 0; i < count; ++i) {
+        const ReferenceMatch* row = batch.data() + i * k;
+        std::vector<double> expected = bruteForceDistances(logRates, kindBits, referenceLog10(readings[i]), k,
+                                                           ReferenceCatalog::ALL_KINDS);
+        size_t found = 0;
+        while (found < k && row[found].index != UINT32_MAX) ++found;
+        bool padded = true;
+        for (size_t j = found; j < k; ++j) padded = padded && row[j].ratio == 0.0;
+        if (!padded || !sameMatches(catalog, logRates, kindBits, readings[i], row, found, expected,
+                                    ReferenceCatalog::ALL_KINDS)) {
+            ++batchMismatches;
+        }
+    }
+
+    // Lecturas sin referencias: NaN y negativas; el cero sí se compara
+    const double invalidReadings[] = { std::nan(""), -1.0, -1e-300, -HUGE_VAL };
+    size_t invalidMatches = 0;
+    std::vector<ReferenceMatch> invalidBatch(4 * k);
+    catalog.annotateBatch(invalidReadings, 4, k, invalidBatch.data());
+    for (size_t i = 0; i < 4; ++i) {
+        if (!catalog.findNearest(invalidReadings[i], k).empty()) ++invalidMatches;
+        for (size_t j = 0; j < k; ++j) {
+            if (invalidBatch[i * k + j].index != UINT32_MAX) ++invalidMatches;
+        }
+    }
+    bool zeroMatches = catalog.findNearest(0.0, k).size() == std::min(k, catalog.getReferenceCount());
+
+    // Tasas mal formadas o no finitas
+    const char* badLines[] = { "site 1.0abc Sitio", "site 0x10 Sitio", "site inf Sitio", "site nan Sitio",
+                               "site -2 Sitio", "site 0 Sitio", "site 1e999 Sitio", "site 1.0" };
+    size_t acceptedBadRates = 0;
+    size_t before = catalog.getReferenceCount();
+    for (const char* line : badLines) {
+        if (catalog.loadFromString(line) >= 0) ++acceptedBadRates;
+    }
+    const double badRates[] = { HUGE_VAL, std::nan(""), 0.0, -1.0 };
+    for (double rate : badRates) {
+        if (catalog.addReference({ "Inválida", ReferenceKind::SITE, rate })) ++acceptedBadRates;
+    }
+    acceptedBadRates += catalog.getReferenceCount() != before;
+
+    bool passed = loaded && nearestMismatches == 0 && batchMismatches == 0 && invalidMatches == 0 &&
+                  zeroMatches && acceptedBadRates == 0;
+
+    std::printf("{\n");
+    std::printf("  \"readings\": %zu,\n", count);
+    std::printf("  \"references\": %zu,\n", logRates.size());
+    std::printf("  \"k\": %zu,\n", k);
+    std::printf("  \"find_nearest_mismatches\": %zu,\n", nearestMismatches);
+    std::printf("  \"annotate_batch_mismatches\": %zu,\n", batchMismatches);
+    std::printf("  \"invalid_reading_matches\": %zu,\n", invalidMatches);
+    std::printf("  \"zero_reading_matched\": %s,\n", zeroMatches ? "true" : "false");
+    std::printf("  \"accepted_bad_rates\": %zu,\n", acceptedBadRates);
+    std::printf("  \"passed\": %s\n", passed ? "true" : "false");
+    std::printf("}\n");
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+// Benchmark de renderizado de los widgets Fallout sin pantalla.
+//
+// Uso: RenderBenchmark [--panels N] [--frames F] [--frame-ms M] [--output archivo.json]
+//
+// Construye un panel de control con N paneles, aplica actualizaciones
+// guionizadas (nivel de peligro, texto con efecto máquina de escribir,
+// animación de barras) y mide tiempo de pintado, tiempo de pulido de estilo,
+// despertares de temporizador por segundo y memoria pico. Emite JSON.
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QGridLayout>
+#include <QImage>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+#include "DangerLevelBridge.h"
+#include "FalloutStyleWidget.h"
+#include "RadiationCalculator.h"
+
+namespace {
+    struct Panel {
+        FalloutStyleWidget* frame;
+        FalloutLabel* title;
+        FalloutButton* status;
+        FalloutProgressBar* gauge;
+        FalloutTextDisplay* console;
+    };
+
+    struct Stats {
+        double mean;
+        double p50;
+        double p95;
+        double max;
+    };
+
+    class TimerWakeupCounter : public QObject {
+    public:
+        long long wakeups = 0;
+
+    protected:
+        bool eventFilter(QObject* watched, QEvent* event) override {
+            if (event->type() == QEvent::Timer) {
+                ++wakeups;
+            }
+            return QObject::eventFilter(watched, event);
+        }
+    };
+
+    Stats summarize(std::vector<double> samples) {
+        Stats stats = {0.0, 0.0, 0.0, 0.0};
+        if (samples.empty()) return stats;
+
+        std::sort(samples.begin(), samples.end());
+        double total = 0.0;
+        for (double s : samples) total += s;
+
+        stats.mean = total / samples.size();
+        stats.p50 = samples[samples.size() / 2];
+        stats.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+        stats.max = samples.back();
+        return stats;
+    }
+
+    std::string statsJson(const Stats& stats) {
+        char buffer[160];
+        std::snprintf(buffer, sizeof(buffer),
+                      "{\"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"max\": %.4f}",
+                      stats.mean, stats.p50, stats.p95, stats.max);
+        return buffer;
+    }
+
+    long peakMemoryKb() {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024;  // macOS informa en bytes
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+
+    const DangerLevel DANGER_LEVELS[] = {
+        DangerLevel::SAFE, DangerLevel::CAUTION, DangerLevel::DANGEROUS,
+        DangerLevel::EXTREME, DangerLevel::LETHAL
+    };
+    const double SCRIPTED_READINGS[] = { 0.2, 1.1, 35.0, 450.0, 2500.0 };
+}
+
+int main(int argc, char *argv[]) {
+    int panelCount = 16;
+    int frameCount = 120;
+    int frameMs = 16;
+    const char* outputPath = nullptr;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--panels") == 0) panelCount = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--frames") == 0) frameCount = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--frame-ms") == 0) frameMs = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--output") == 0) outputPath = argv[i + 1];
+    }
+
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication app(argc, argv);
+    TimerWakeupCounter wakeupCounter;
+    app.installEventFilter(&wakeupCounter);
+
+    // Construcción del panel de control
+    QElapsedTimer clock;
+    clock.start();
+
+    QWidget dashboard;
+    QGridLayout* grid = new QGridLayout(&dashboard);
+    int columns = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(panelCount)))));
+    std::vector<Panel> panels;
+
+    for (int i = 0; i < panelCount; ++i) {
+        Panel panel;
+        panel.frame = new FalloutStyleWidget(&dashboard);
+        QVBoxLayout* layout = new QVBoxLayout(panel.frame);
+
+        panel.title = new FalloutLabel(QString("SENSOR %1").arg(i + 1), panel.frame);
+        panel.title->setGlowEffect(true);
+        panel.status = new FalloutButton("ESTADO", panel.frame);
+        panel.gauge = new FalloutProgressBar(panel.frame);
+        panel.console = new FalloutTextDisplay(panel.frame);
+
+        layout->addWidget(panel.title);
+        layout->addWidget(panel.status);
+        layout->addWidget(panel.gauge);
+        layout->addWidget(panel.console);
+        grid->addWidget(panel.frame, i / columns, i % columns);
+        panels.push_back(panel);
+    }
+
+    dashboard.resize(columns * 320, ((panelCount + columns - 1) / columns) * 240);
+    dashboard.show();
+    app.processEvents();
+    double constructionMs = clock.nsecsElapsed() / 1000000.0;
+
+    // Actualizaciones guionizadas
+    RadiationCalculator calculator;
+    QImage target(dashboard.size(), QImage::Format_ARGB32_Premultiplied);
+    std::vector<double> paintSamples;
+    std::vector<double> polishSamples;
+    paintSamples.reserve(frameCount);
+    polishSamples.reserve(frameCount);
+
+    long long wakeupsBefore = wakeupCounter.wakeups;
+    QElapsedTimer runClock;
+    runClock.start();
+
+    for (int frame = 0; frame < frameCount; ++frame) {
+        clock.restart();
+        for (int i = 0; i < panelCount; ++i) {
+            int step = (frame / 10 + i) % 5;
+            Panel& panel = panels[i];
+            double reading = SCRIPTED_READINGS[step];
+
+            panel.status->setDangerLevel(DANGER_LEVELS[step]);
+            panel.gauge->setDangerLevel(calculator.getDangerPercentage(reading));
+            if (frame % 10 == 0) {
+                panel.gauge->animateToValue(calculator.getDangerPercentage(reading));
+                panel.title->setText(DangerLevelBridge::getAutoFormattedValue(reading));
+                panel.console->typewriterEffect(
+                    DangerLevelBridge::getDangerDescription(calculator.getDangerLevel(reading)), 5);
+            }
+            panel.status->ensurePolished();
+        }
+        polishSamples.push_back(clock.nsecsElapsed() / 1000000.0);
+
+        clock.restart();
+        dashboard.render(&target);
+        paintSamples.push_back(clock.nsecsElapsed() / 1000000.0);
+
+        // Deja correr los temporizadores de animación durante el resto del frame
+        QElapsedTimer frameClock;
+        frameClock.start();
+        while (frameClock.elapsed() < frameMs) {
+            app.processEvents(QEventLoop::AllEvents, frameMs);
+        }
+    }
+
+    double runSeconds = runClock.nsecsElapsed() / 1000000000.0;
+    double wakeupsPerSecond = runSeconds > 0.0 ? (wakeupCounter.wakeups - wakeupsBefore) / runSeconds : 0.0;
+
+    std::string json = "{\n";
+    json += "  \"benchmark\": \"fallout_widgets\",\n";
+    json += "  \"qpa_platform\": \"" + qEnvironmentVariable("QT_QPA_PLATFORM").toStdString() + "\",\n";
+    json += "  \"panels\": " + std::to_string(panelCount) + ",\n";
+    json += "  \"frames\": " + std::to_string(frameCount) + ",\n";
+    json += "  \"construction_ms\": " + std::to_string(constructionMs) + ",\n";
+    json += "  \"paint_ms\": " + statsJson(summarize(paintSamples)) + ",\n";
+    json += "  \"polish_ms\": " + statsJson(summarize(polishSamples)) + ",\n";
+    json += "  \"timer_wakeups_per_sec\": " + std::to_string(wakeupsPerSecond) + ",\n";
+    json += "  \"peak_rss_kb\": " + std::to_string(peakMemoryKb()) + "\n";
+    json += "}\n";
+
+    FILE* out = outputPath ? std::fopen(outputPath, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "No se pudo abrir %s\n", outputPath);
+        return 1;
+    }
+    std::fputs(json.c_str(), out);
+    if (out != stdout) std::fclose(out);
+
+    return 0;
+}
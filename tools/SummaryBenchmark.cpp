@@ -0,0 +1,165 @@
+// Benchmark del resumen paralelo de dosis.
+//
+// Uso: SummaryBenchmark [--records N] [--sites S] [--sensors M] [--threads T]
+//                       [--verify V]
+//
+// Genera N lecturas sintéticas repartidas entre M sensores de S sitios,
+// las resume por sensor y por sitio y estima el tiempo para mil millones
+// de registros. Las primeras V lecturas se comparan con un bucle ingenuo
+// sobre getDangerLevel y std::unordered_map, agrupando por sensor y por
+// sitio, con la duración por defecto y con una columna de duraciones con
+// lecturas no finitas intercaladas; devuelve 1 si no coinciden.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+#include "DoseSummarizer.h"
+#include "ScenarioGenerator.h"
+
+namespace {
+    bool nearlyEqual(double a, double b) {
+        return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::max(std::fabs(a), std::fabs(b)));
+    }
+
+    bool verifyAgainstNaive(const SummaryInput& input, size_t count, SummaryGrouping grouping) {
+        SummaryInput prefix = input;
+        prefix.count = count;
+        SummaryOptions options;
+        options.grouping = grouping;
+        DoseSummarizer summarizer;
+        std::vector<DoseSummary> fast = summarizer.summarize(prefix, options);
+
+        RadiationCalculator calculator;
+        std::unordered_map<uint64_t, DoseSummary> naive;
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t sensor = grouping == SummaryGrouping::BY_SITE ? DoseSummarizer::ALL_SENSORS : input.sensorIds[i];
+            uint64_t key = (static_cast<uint64_t>(input.siteIds[i]) << 32) | sensor;
+            DoseSummary& summary = naive[key];
+            summary.siteId = input.siteIds[i];
+            summary.sensorId = sensor;
+            double rate = input.microSievertsPerHour[i];
+            double hours = input.durationHours ? input.durationHours[i] : input.defaultDurationHours;
+            if (!std::isfinite(rate) || !std::isfinite(hours)) {
+                summary.invalidRecords++;
+                continue;
+            }
+            DangerLevel level = calculator.getDangerLevel(rate);
+            summary.records++;
+            summary.hoursInLevel[static_cast<int>(level)] += hours;
+            for (int j = 0; j < 4; ++j) {
+                if (rate >= RadiationCalculator::DANGER_THRESHOLDS[j]) summary.exceedances[j]++;
+            }
+            summary.peakMicroSievertsPerHour = std::max(summary.peakMicroSievertsPerHour, rate);
+            summary.integratedMicroSieverts += rate * hours;
+        }
+
+        if (fast.size() != naive.size()) return false;
+        for (const DoseSummary& summary : fast) {
+            const DoseSummary& expected = naive[(static_cast<uint64_t>(summary.siteId) << 32) | summary.sensorId];
+            if (summary.records != expected.records) return false;
+            if (summary.invalidRecords != expected.invalidRecords) return false;
+            if (summary.peakMicroSievertsPerHour != expected.peakMicroSievertsPerHour) return false;
+            if (!nearlyEqual(summary.integratedMicroSieverts, expected.integratedMicroSieverts)) return false;
+            for (int l = 0; l < 5; ++l) {
+                if (!nearlyEqual(summary.hoursInLevel[l], expected.hoursInLevel[l])) return false;
+            }
+            for (int j = 0; j < 4; ++j) {
+                if (summary.exceedances[j] != expected.exceedances[j]) return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t records = 50000000;
+    uint32_t sites = 64;
+    uint32_t sensors = 16384;
+    unsigned threads = 0;
+    size_t verifyCount = 2000000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--records") == 0) records = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (std::strcmp(argv[i], "--sites") == 0) sites = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--sensors") == 0) sensors = std::max(1, std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--threads") == 0) threads = static_cast<unsigned>(std::atoi(argv[i + 1]));
+        else if (std::strcmp(argv[i], "--verify") == 0) verifyCount = std::strtoull(argv[i + 1], nullptr, 10);
+    }
+    records = std::max<size_t>(1, records);
+    verifyCount = std::min(verifyCount, records);
+
+    // Lecturas por turnos de sensor, como llegarían de la red de medida
+    std::vector<uint32_t> siteIds(records);
+    std::vector<uint32_t> sensorIds(records);
+    std::vector<double> rates(records);
+    ScenarioRandom random(2287);
+    for (size_t i = 0; i < records; ++i) {
+        uint32_t sensor = static_cast<uint32_t>(i % sensors);
+        sensorIds[i] = sensor;
+        siteIds[i] = sensor % sites;
+        rates[i] = random.nextLogUniform(0.01, 5000.0);
+    }
+
+    SummaryInput input;
+    input.count = records;
+    input.siteIds = siteIds.data();
+    input.sensorIds = sensorIds.data();
+    input.microSievertsPerHour = rates.data();
+
+    SummaryOptions options;
+    options.workerThreads = threads;
+
+    DoseSummarizer summarizer;
+    std::vector<DoseSummary> bySensor = summarizer.summarize(input, options);
+    double sensorSeconds = summarizer.getLastElapsedSeconds();
+    unsigned workers = summarizer.getLastWorkerCount();
+
+    options.grouping = SummaryGrouping::BY_SITE;
+    std::vector<DoseSummary> bySite = summarizer.summarize(input, options);
+    double siteSeconds = summarizer.getLastElapsedSeconds();
+
+    DoseSummary total = DoseSummarizer::combineAll(bySite);
+
+    // Copia del prefijo verificado con duraciones variables (1 s a 10 min)
+    // y algunas tasas o duraciones no finitas
+    std::vector<double> verifyRates(rates.begin(), rates.begin() + verifyCount);
+    std::vector<double> verifyDurations(verifyCount);
+    for (size_t i = 0; i < verifyCount; ++i) {
+        verifyDurations[i] = random.nextLogUniform(1.0, 600.0) / 3600.0;
+        if (i % 1009 == 7) verifyRates[i] = std::nan("");
+        if (i % 2003 == 11) verifyRates[i] = HUGE_VAL;
+        if (i % 3001 == 13) verifyDurations[i] = std::nan("");
+    }
+    SummaryInput withDurations = input;
+    withDurations.microSievertsPerHour = verifyRates.data();
+    withDurations.durationHours = verifyDurations.data();
+
+    bool verified = verifyCount == 0 ||
+                    (verifyAgainstNaive(input, verifyCount, SummaryGrouping::BY_SENSOR) &&
+                     verifyAgainstNaive(input, verifyCount, SummaryGrouping::BY_SITE) &&
+                     verifyAgainstNaive(withDurations, verifyCount, SummaryGrouping::BY_SENSOR) &&
+                     verifyAgainstNaive(withDurations, verifyCount, SummaryGrouping::BY_SITE));
+
+    std::printf("{\n");
+    std::printf("  \"records\": %zu,\n", records);
+    std::printf("  \"threads\": %u,\n", workers);
+    std::printf("  \"by_sensor\": { \"groups\": %zu, \"seconds\": %.3f, \"records_per_second\": %.0f, \"projected_seconds_per_billion\": %.2f },\n",
+                bySensor.size(), sensorSeconds, records / sensorSeconds, sensorSeconds * 1e9 / records);
+    std::printf("  \"by_site\": { \"groups\": %zu, \"seconds\": %.3f, \"records_per_second\": %.0f, \"projected_seconds_per_billion\": %.2f },\n",
+                bySite.size(), siteSeconds, records / siteSeconds, siteSeconds * 1e9 / records);
+    std::printf("  \"hours_in_level\": [%.1f, %.1f, %.1f, %.1f, %.1f],\n",
+                total.hoursInLevel[0], total.hoursInLevel[1], total.hoursInLevel[2],
+                total.hoursInLevel[3], total.hoursInLevel[4]);
+    std::printf("  \"exceedances\": [%llu, %llu, %llu, %llu],\n",
+                static_cast<unsigned long long>(total.exceedances[0]), static_cast<unsigned long long>(total.exceedances[1]),
+                static_cast<unsigned long long>(total.exceedances[2]), static_cast<unsigned long long>(total.exceedances[3]));
+    std::printf("  \"peak_usv_h\": %.3f,\n", total.peakMicroSievertsPerHour);
+    std::printf("  \"integrated_usv\": %.3f,\n", total.integratedMicroSieverts);
+    std::printf("  \"verified_records\": %zu,\n", verifyCount);
+    std::printf("  \"verified\": %s\n", verified ? "true" : "false");
+    std::printf("}\n");
+    return verified ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+// Verificación del registro de unidades frente a las conversiones originales.
+//
+// Uso: UnitRegistryCheck [--count N]
+//
+// Compara convertToMicroSieverts, formatWithUnit, getAutoFormattedValue e
+// isValidRadiationLevel de RadiationCalculator (que pasan por UnitRegistry)
+// con una copia de las implementaciones con switch anteriores al registro,
+// para las tres unidades de RadiationUnit. También comprueba que
+// convertColumn y convertMixedColumn dan los mismos bits que la ruta
+// escalar y NaN para unidades desconocidas, y que el registro por defecto
+// está congelado. Devuelve 1 si algo no coincide.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "RadiationCalculator.h"
+#include "UnitRegistry.h"
+
+namespace {
+    const RadiationUnit UNITS[] = {
+        RadiationUnit::MICROSIEVERTS_PER_HOUR,
+        RadiationUnit::MILLISIEVERTS_PER_HOUR,
+        RadiationUnit::SIEVERTS_PER_HOUR
+    };
+
+    // Implementaciones originales de RadiationCalculator, sin cambios
+    double legacyConvertToMicroSieverts(double value, RadiationUnit unit) {
+        switch (unit) {
+            case RadiationUnit::MICROSIEVERTS_PER_HOUR:
+                return value;
+            case RadiationUnit::MILLISIEVERTS_PER_HOUR:
+                return value * 1000.0;
+            case RadiationUnit::SIEVERTS_PER_HOUR:
+                return value * 1000000.0;
+            default:
+                return 0.0;
+        }
+    }
+
+    std::string legacyFormatWithUnit(double microSieverts, RadiationUnit targetUnit) {
+        std::ostringstream oss;
+        oss << std::fixed;
+
+        switch (targetUnit) {
+            case RadiationUnit::MICROSIEVERTS_PER_HOUR:
+                oss << std::setprecision(1) << microSieverts << " μSv/h";
+                break;
+            case RadiationUnit::MILLISIEVERTS_PER_HOUR:
+                oss << std::setprecision(3) << microSieverts / 1000.0 << " mSv/h";
+                break;
+            case RadiationUnit::SIEVERTS_PER_HOUR:
+                oss << std::setprecision(6) << microSieverts / 1000000.0 << " Sv/h";
+                break;
+        }
+
+        return oss.str();
+    }
+
+    std::string legacyAutoFormattedValue(double microSieverts) {
+        if (microSieverts >= 1000000.0) {
+            return legacyFormatWithUnit(microSieverts, RadiationUnit::SIEVERTS_PER_HOUR);
+        } else if (microSieverts >= 1000.0) {
+            return legacyFormatWithUnit(microSieverts, RadiationUnit::MILLISIEVERTS_PER_HOUR);
+        } else {
+            return legacyFormatWithUnit(microSieverts, RadiationUnit::MICROSIEVERTS_PER_HOUR);
+        }
+    }
+
+    bool legacyIsValidRadiationLevel(double value, RadiationUnit unit) {
+        if (value < 0) return false;
+
+        double microSieverts = legacyConvertToMicroSieverts(value, unit);
+        return microSieverts <= 1000000000.0;
+    }
+
+    // Igualdad bit a bit salvo NaN, que se considera igual a cualquier NaN
+    bool sameDouble(double a, double b) {
+        if (std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    size_t count = 200000;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--count") == 0) count = std::max(1, std::atoi(argv[i + 1]));
+    }
+
+    // Valores log-uniformes de 1e-6 a 1e12 con signo alterno, más los
+    // cortes de formato y los no finitos
+    std::vector<double> values;
+    values.reserve(count + 16);
+    for (size_t i = 0; i < count; ++i) {
+        double magnitude = std::pow(10.0, -6.0 + 18.0 * static_cast<double>(i) / count);
+        values.push_back(i % 7 == 3 ? -magnitude : magnitude);
+    }
+    const double edges[] = { 0.0, -0.0, 0.05, 0.95, 999.9999, 1000.0, 999999.9999, 1000000.0,
+                             1000000000.0, 1000000000.0000001, HUGE_VAL, -HUGE_VAL, std::nan("") };
+    values.insert(values.end(), std::begin(edges), std::end(edges));
+
+    RadiationCalculator calculator;
+    UnitRegistry& registry = UnitRegistry::getDefault();
+    size_t convertMismatches = 0;
+    size_t formatMismatches = 0;
+    size_t autoFormatMismatches = 0;
+    size_t validityMismatches = 0;
+    size_t columnMismatches = 0;
+
+    for (double value : values) {
+        for (RadiationUnit unit : UNITS) {
+            if (!sameDouble(calculator.convertToMicroSieverts(value, unit), legacyConvertToMicroSieverts(value, unit))) {
+                ++convertMismatches;
+            }
+            if (calculator.formatWithUnit(value, unit) != legacyFormatWithUnit(value, unit)) {
+                ++formatMismatches;
+            }
+            if (calculator.isValidRadiationLevel(value, unit) != legacyIsValidRadiationLevel(value, unit)) {
+                ++validityMismatches;
+            }
+        }
+        if (calculator.getAutoFormattedValue(value) != legacyAutoFormattedValue(value)) {
+            ++autoFormatMismatches;
+        }
+    }
+
+    // Un valor fuera de RadiationUnit conserva el 0.0 del default del switch
+    RadiationUnit unknownUnit = static_cast<RadiationUnit>(3);
+    if (!sameDouble(calculator.convertToMicroSieverts(1.0, unknownUnit), legacyConvertToMicroSieverts(1.0, unknownUnit))) {
+        ++convertMismatches;
+    }
+
+    // Columnas: mismos bits que la ruta escalar, NaN para unidades desconocidas
+    std::vector<double> column(values.size());
+    std::vector<uint16_t> unitIds(values.size());
+    for (RadiationUnit unit : UNITS) {
+        registry.convertColumn(UnitRegistry::getUnitId(unit), values.data(), values.size(), column.data());
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!sameDouble(column[i], legacyConvertToMicroSieverts(values[i], unit))) ++columnMismatches;
+        }
+    }
+    uint16_t unknownId = static_cast<uint16_t>(registry.getUnitCount());
+    for (size_t i = 0; i < values.size(); ++i) {
+        unitIds[i] = i % 5 == 4 ? unknownId : static_cast<uint16_t>(i % 3);
+    }
+    registry.convertMixedColumn(unitIds.data(), values.data(), values.size(), column.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        double expected = unitIds[i] == unknownId ? std::nan("")
+                        : legacyConvertToMicroSieverts(values[i], UNITS[unitIds[i]]);
+        if (!sameDouble(column[i], expected)) ++columnMismatches;
+    }
+    registry.convertColumn(unknownId, values.data(), values.size(), column.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (!std::isnan(column[i])) ++columnMismatches;
+    }
+
+    bool frozen = registry.isFrozen() &&
+                  registry.registerUnit({ "test/h", "", UnitQuantity::DOSE_RATE, 1.0, 0.0, 1 }) < 0;
+
+    size_t total = convertMismatches + formatMismatches + autoFormatMismatches + validityMismatches + columnMismatches;
+    bool passed = total == 0 && frozen;
+
+    std::printf("{\n");
+    std::printf("  \"values\": %zu,\n", values.size());
+    std::printf("  \"convert_mismatches\": %zu,\n", convertMismatches);
+    std::printf("  \"format_mismatches\": %zu,\n", formatMismatches);
+    std::printf("  \"auto_format_mismatches\": %zu,\n", autoFormatMismatches);
+    std::printf("  \"validity_mismatches\": %zu,\n", validityMismatches);
+    std::printf("  \"column_mismatches\": %zu,\n", columnMismatches);
+    std::printf("  \"default_registry_frozen\": %s,\n", frozen ? "true" : "false");
+    std::printf("  \"passed\": %s\n", passed ? "true" : "false");
+    std::printf("}\n");
+
+    return passed ? 0 : 1;
+}